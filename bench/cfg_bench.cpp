@@ -0,0 +1,145 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * CFG Benchmark - The --graph pipeline vs. the previous regex implementation
+ *
+ * Usage: cfg_bench <listing.asm> [repeat]
+ * The listing is concatenated `repeat` times (default 50) to reach multi-million-line
+ * inputs, then both run on the same text. The pipeline is what --graph ships:
+ * Listing::parseLine, ControlFlowGraph and Visualizer::renderMermaid. Its graph is
+ * block level, so only the function sets of the two are compared.
+ * 목록을 repeat번 이어 붙여 같은 입력으로 실행합니다. 파이프라인은 --graph가 실제로 쓰는
+ * Listing::parseLine, ControlFlowGraph, Visualizer::renderMermaid이며, 블록 수준 그래프이므로
+ * 두 결과의 함수 집합만 비교합니다.
+ */
+#include "../src/listing.h"
+#include "../src/control_flow.h"
+#include "../src/visualizer.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <tuple>
+
+namespace {
+// Previous implementation, kept verbatim as the reference / 기준으로 유지한 이전 구현
+std::string legacyMermaidCFG(const std::string& asmText) {
+    std::stringstream ss(asmText);
+    std::string line;
+    std::string currentFunction = "unknown";
+    std::set<std::string> functions;
+    std::set<std::tuple<std::string, std::string, std::string>> edges;
+
+    std::regex funcRegex(R"([0-9a-fA-F]+\s+<([^>]+)>:)");
+    std::regex targetRegex(R"(<([^>+]+)(?:\+0x[0-9a-fA-F]+)?>)");
+
+    while (std::getline(ss, line)) {
+        std::smatch match;
+        if (std::regex_search(line, match, funcRegex)) {
+            currentFunction = match[1].str();
+            functions.insert(currentFunction);
+        } else if (currentFunction != "unknown") {
+            if (line.find("call") != std::string::npos ||
+                line.find("jmp") != std::string::npos ||
+                (line.find("j") == line.find_first_of("j") && line.find("j") != std::string::npos)) {
+                std::string::const_iterator searchStart(line.cbegin());
+                while (std::regex_search(searchStart, line.cend(), match, targetRegex)) {
+                    std::string target = match[1].str();
+                    if (target != currentFunction) {
+                        std::string label = line.find("call") != std::string::npos ? "calls" : "jumps to";
+                        edges.insert(std::make_tuple(currentFunction, target, label));
+                    }
+                    searchStart = match[0].second;
+                }
+            }
+        }
+    }
+
+    std::stringstream mermaid;
+    mermaid << "graph TD\n";
+    mermaid << "  %% Monster Grade Analysis / (C) Rheehose 2008-2026\n";
+    for (const auto& func : functions) {
+        mermaid << "  " << func << "[" << func << "]\n";
+    }
+    for (const auto& edge : edges) {
+        mermaid << "  " << std::get<0>(edge) << " -- " << std::get<2>(edge) << " --> " << std::get<1>(edge) << "\n";
+    }
+    return mermaid.str();
+}
+
+// Function names from the legacy header lines / 이전 구현의 함수 헤더 행에서 얻은 함수 이름
+std::set<std::string> legacyFunctions(const std::string& mermaid) {
+    std::set<std::string> names;
+    std::stringstream ss(mermaid);
+    std::string line;
+    while (std::getline(ss, line)) {
+        size_t open = line.find('[');
+        if (line.compare(0, 2, "  ") == 0 && open != std::string::npos && line.back() == ']') {
+            names.insert(line.substr(2, open - 2));
+        }
+    }
+    return names;
+}
+
+// What --graph runs on each line, then once at the end / --graph가 행마다, 그리고 끝에 한 번 실행하는 과정
+std::string pipelineMermaidCFG(const std::string& asmText, ControlFlowGraph& graph) {
+    std::string_view text(asmText);
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t nl = text.find('\n', pos);
+        if (nl == std::string_view::npos) nl = text.size();
+        graph.addRecord(Listing::parseLine(text.substr(pos, nl - pos)));
+        pos = nl + 1;
+    }
+    graph.finalize();
+    return Visualizer::renderMermaid(graph);
+}
+
+template <typename Fn>
+double timeSeconds(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: cfg_bench <listing.asm> [repeat]" << std::endl;
+        return 2;
+    }
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in.is_open()) {
+        std::cerr << "Cannot open " << argv[1] << std::endl;
+        return 2;
+    }
+    std::string one((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    int repeat = argc > 2 ? std::max(1, std::atoi(argv[2])) : 50;
+
+    std::string text;
+    text.reserve(one.size() * repeat);
+    for (int i = 0; i < repeat; ++i) text += one;
+    size_t lines = static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+
+    ControlFlowGraph graph;
+    std::string fast, legacy;
+    double tFast = timeSeconds([&] { fast = pipelineMermaidCFG(text, graph); });
+    double tLegacy = timeSeconds([&] { legacy = legacyMermaidCFG(text); });
+
+    std::cout << "lines:    " << lines << "\n";
+    std::cout << "pipeline: " << tFast << " s (" << static_cast<long long>(lines / tFast) << " lines/s, "
+              << graph.functionCount() << " functions, " << graph.blockCount() << " blocks)\n";
+    std::cout << "regex:    " << tLegacy << " s (" << static_cast<long long>(lines / tLegacy) << " lines/s)\n";
+    std::cout << "speedup:  " << tLegacy / tFast << "x\n";
+    std::set<std::string> functions;
+    for (uint32_t fn = 0; fn < graph.functionCount(); ++fn) functions.insert(std::string(graph.functionName(fn)));
+    if (functions != legacyFunctions(legacy)) {
+        std::cout << "MISMATCH: function sets differ" << std::endl;
+        return 1;
+    }
+    std::cout << "function sets identical" << std::endl;
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Analysis Implementation - Streaming pipeline for a single input
+ */
+#include "analysis.h"
+#include <fstream>
+#include <memory>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include "visualizer.h"
+#include "stream_sink.h"
+#include "strings_sink.h"
+
+namespace {
+constexpr long long kTailSampleInterval = 1 << 20; // Listing bytes between samples / 표본 간 목록 바이트
+constexpr size_t kTailSampleBytes = 4096;
+
+// Counts records on their way to the output sink / 출력 싱크로 가는 레코드 수 집계
+class CountingSink : public StringsSink {
+public:
+    explicit CountingSink(StringsSink& next) : m_next(next) {}
+    void write(const Record& r) override {
+        ++count;
+        m_next.write(r);
+    }
+    void flush() override { m_next.flush(); }
+
+    size_t count = 0;
+
+private:
+    StringsSink& m_next;
+};
+}
+
+Analysis::Analysis(Options opts) : m_opts(std::move(opts)) {
+    m_info = BinaryInfo::load(m_opts.infile);
+    // Intel syntax only applies to x86 / Intel 문법은 x86에만 적용
+    if (m_opts.intel && m_info.format != BinaryInfo::Format::Unknown && !m_info.isX86()) m_opts.intel = false;
+    // Set up before any renderer thread reads it / 렌더러 스레드가 읽기 전에 준비
+    m_progress.reset(m_info);
+}
+
+std::string Analysis::objdumpError(int code) {
+    // A missing objdump, versus one that ran and rejected the input / objdump 부재와 입력 거부를 구분
+    if (code == Disassembler::kNotStarted) return std::string(I18n::instance().get(Msg::ObjdumpFailed));
+    return std::string(I18n::instance().get(Msg::ObjdumpStatus)) + " " + std::to_string(code);
+}
+
+bool Analysis::fail(const std::string& message) {
+    m_error = message;
+    return false;
+}
+
+bool Analysis::fail(Msg msg, const std::string& detail) {
+    std::string message(I18n::instance().get(msg));
+    if (!detail.empty()) message += ": " + detail;
+    return fail(message);
+}
+
+std::string Analysis::cacheKey(const char* kind, const std::string& options) {
+    if (!m_opts.cache || !m_opts.cache->isEnabled()) return std::string();
+    if (m_hashState == 0) m_hashState = ResultCache::hashFile(m_opts.infile, m_contentHash) ? 1 : -1;
+    return m_hashState > 0 ? ResultCache::key(m_contentHash, kind, options) : std::string();
+}
+
+bool Analysis::disassemble(const Disassembler::Progress& progress) {
+    FileSink out(m_opts.outfile);
+    if (!out.isOpen()) return fail(Msg::OutputFileFailed, m_opts.outfile);
+    std::string key = cacheKey("asm", ResultCache::listingOptions(m_opts.intel, m_info.arch));
+    std::string cached = key.empty() ? std::string() : m_opts.cache->lookup(key);
+
+    // Stream chunks straight to disk; each line is parsed once for the graph and export
+    // 청크를 디스크로 바로 스트리밍하고, 그래프와 내보내기를 위해 각 행을 한 번만 파싱
+    bool graph = m_opts.graph;
+    bool exporting = !m_opts.exportfile.empty();
+    LineSink records([&](std::string_view line) {
+        Listing::Fields fields = Listing::parseLine(line);
+        if (graph) m_graph.addRecord(fields);
+        if (exporting) m_listing.append(line, fields);
+    });
+    TeeSink pipeline;
+    pipeline.add(&out);
+    if (graph || exporting) pipeline.add(&records);
+    pipeline.add(&m_progress);
+
+    auto counted = [this, &progress](long long processed) {
+        m_bytes = processed;
+        if (progress) progress(processed);
+    };
+    // A hit replaces objdump entirely; the graph and export still parse the cached lines
+    // 적중 시 objdump를 완전히 대체하며, 그래프와 내보내기는 캐시된 행을 파싱
+    m_listingCached = !cached.empty() && ResultCache::streamListing(cached, m_opts.infile, pipeline, counted);
+    if (!m_listingCached) {
+        if (m_bytes > 0) return fail(Msg::OutputFileFailed, cached);
+        std::unique_ptr<ResultCache::Writer> store;
+        if (!key.empty()) store = std::make_unique<ResultCache::Writer>(*m_opts.cache, key);
+        Disassembler::Options opts;
+        opts.file = m_opts.infile;
+        opts.intel = m_opts.intel;
+        opts.jobs = m_opts.jobs;
+        if (!graph && !exporting) {
+            if (!disassembleToFile(opts, out, store.get(), counted)) return false;
+        } else {
+            if (store) pipeline.add(store.get());
+            // A listing cut short by a failing objdump must never be served as the real one
+            // 실패한 objdump가 중간에 끊은 목록은 실제 목록으로 제공되면 안 됨
+            if (int code = Disassembler::run(opts, pipeline, counted)) return fail(objdumpError(code));
+            if (store && m_bytes > 0) store->commit();
+        }
+    }
+
+    m_progress.finish();
+    out.close();
+    if (!out.good()) return fail(Msg::OutputFileFailed, m_opts.outfile);
+    if (graph) m_graph.finalize();
+    return true;
+}
+
+bool Analysis::disassembleToFile(const Disassembler::Options& opts, FileSink& out, ResultCache::Writer* store,
+                                 const Disassembler::Progress& progress) {
+    // Nothing reads the listing, so it moves from objdump to the file in the kernel; a second
+    // descriptor samples the tail for the progress display and fills the cache afterwards
+    // 목록을 읽는 곳이 없으므로 커널 안에서 objdump에서 파일로 옮기고, 두 번째 디스크립터로
+    // 끝부분을 표본 추출해 진행 표시에 쓰며 이후 캐시를 채움
+    int reader = ::open(m_opts.outfile.c_str(), O_RDONLY | O_CLOEXEC);
+    long long sampled = 0;
+    bool written = true;
+    int code = Disassembler::runToFile(opts, out.fd(), written, [&](long long processed) {
+        progress(processed);
+        if (reader < 0 || processed - sampled < kTailSampleInterval) {
+            m_progress.observe(std::string_view(), processed);
+            return;
+        }
+        sampled = processed;
+        char tail[kTailSampleBytes];
+        long long at = std::max(0LL, processed - static_cast<long long>(sizeof(tail)));
+        ssize_t n = pread(reader, tail, sizeof(tail), at);
+        m_progress.observe(std::string_view(tail, n > 0 ? static_cast<size_t>(n) : 0), processed);
+    });
+    // Only a clean exit is cached; a failed write reports first, since objdump then dies of SIGPIPE
+    // 정상 종료만 캐시하며, 쓰기 실패 시 objdump가 SIGPIPE로 끝나므로 쓰기 오류를 먼저 보고
+    bool stored = code == 0 && written && store && m_bytes > 0 && reader >= 0 && store->copyFrom(reader, m_bytes);
+    if (reader >= 0) ::close(reader);
+    if (!written) return fail(Msg::OutputFileFailed, m_opts.outfile);
+    if (code != 0) return fail(objdumpError(code));
+    if (stored) store->commit();
+    return true;
+}
+
+bool Analysis::writeGraph() {
+    std::string path = m_opts.outfile + ".mermaid";
+    std::string key = cacheKey("mermaid", ResultCache::listingOptions(m_opts.intel, m_info.arch));
+    std::string cached = key.empty() ? std::string() : m_opts.cache->lookup(key);
+    FileSink gout(path);
+    if (cached.empty() || !ResultCache::stream(cached, gout)) {
+        std::string mermaid = Visualizer::renderMermaid(m_graph);
+        gout.write(mermaid.data(), mermaid.size());
+        if (!key.empty()) {
+            ResultCache::Writer store(*m_opts.cache, key);
+            store.write(mermaid.data(), mermaid.size());
+            store.commit();
+        }
+    }
+    gout.close();
+    if (!gout.good()) return fail(Msg::OutputFileFailed, path);
+    return true;
+}
+
+bool Analysis::writeExport() {
+    std::ofstream eout(m_opts.exportfile);
+    m_listing.exportTsv(eout);
+    eout.close();
+    if (!eout) return fail(Msg::OutputFileFailed, m_opts.exportfile);
+    return true;
+}
+
+bool Analysis::writeStrings(const std::string& path, bool json, bool unicode) {
+    FileSink out(path);
+    if (!out.isOpen()) return fail(Msg::OutputFileFailed, path);
+    StringsSink::Options sopts;
+    sopts.file = m_opts.infile;
+    sopts.encodings = unicode ? StringsExtractor::AllEncodings : StringsExtractor::Ascii;
+    sopts.threads = 1; // Batch workers already fill the cores / 배치 작업자가 이미 코어를 채움
+
+    std::string key = cacheKey("strings", ResultCache::stringsOptions(sopts.minLength, sopts.encodings, json, unicode));
+    std::string cached = key.empty() ? std::string() : m_opts.cache->lookup(key);
+    if (!cached.empty()) {
+        // One record per line / 레코드마다 한 행
+        size_t lines = 0;
+        LineSink counter([&lines](std::string_view) { ++lines; });
+        TeeSink tee;
+        tee.add(&out);
+        tee.add(&counter);
+        if (ResultCache::stream(cached, tee)) {
+            out.close();
+            if (!out.good()) return fail(Msg::OutputFileFailed, path);
+            m_strings = lines;
+            return true;
+        }
+    }
+
+    std::unique_ptr<ResultCache::Writer> store;
+    TeeSink tee;
+    tee.add(&out);
+    if (!key.empty()) {
+        store = std::make_unique<ResultCache::Writer>(*m_opts.cache, key);
+        tee.add(store.get());
+    }
+    TextStringsSink text(tee, unicode);
+    NdjsonStringsSink ndjson(tee);
+    CountingSink counter(json ? static_cast<StringsSink&>(ndjson) : text);
+    if (!StringsSink::run(sopts, counter)) return fail("Error: Cannot open file for strings extraction.");
+    if (store) store->commit();
+    out.close();
+    if (!out.good()) return fail(Msg::OutputFileFailed, path);
+    m_strings = counter.count;
+    return true;
+}
@@ -0,0 +1,87 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Analysis Header - One input through disassembly, graph, export and strings
+ */
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#include <string>
+#include "binary_info.h"
+#include "control_flow.h"
+#include "listing.h"
+#include "disassembler.h"
+#include "result_cache.h"
+#include "progress.h"
+#include "i18n.h"
+
+/**
+ * @brief Per-input analysis pipeline shared by the CLI and batch workers
+ * CLI와 배치 작업자가 공유하는 입력별 분석 파이프라인
+ *
+ * disassemble() streams the objdump listing to outfile and parses each line once for
+ * the graph and export; the write*() steps then produce the side outputs. Every step
+ * returns false and sets error() on failure, and nothing is printed. With a cache, hits are
+ * streamed from it instead of running objdump, and misses are stored as they are written.
+ * Without a graph or export the listing is never read: objdump's pipe is spliced into outfile.
+ * disassemble()은 목록을 outfile로 스트리밍하면서 그래프와 내보내기를 위해 각 행을 한 번 파싱하고,
+ * write*() 단계가 부가 출력을 만듭니다. 실패 시 false와 error()를 설정하며 아무것도 출력하지 않습니다.
+ * 캐시가 있으면 적중 시 objdump 대신 캐시에서 스트리밍하고, 미스는 기록하면서 저장합니다.
+ * 그래프와 내보내기가 없으면 목록을 읽지 않고 objdump 파이프를 outfile로 splice합니다.
+ */
+class Analysis {
+public:
+    struct Options {
+        std::string infile;
+        std::string outfile;
+        std::string exportfile; // Empty = no TSV export / 비어 있으면 내보내기 안 함
+        bool intel = false;     // Ignored for non-x86 inputs / x86이 아니면 무시
+        bool graph = false;
+        int jobs = 0;           // objdump workers, <= 1 is serial / objdump 작업자 수
+        ResultCache* cache = nullptr; // Serves and stores listing, graph and strings / 목록, 그래프, 문자열 캐시
+    };
+
+    explicit Analysis(Options opts);
+
+    // Message for a nonzero Disassembler::run() result / Disassembler::run()의 0이 아닌 결과에 대한 메시지
+    static std::string objdumpError(int code);
+
+    const BinaryInfo& info() const { return m_info; }
+    const Options& options() const { return m_opts; }
+    const std::string& error() const { return m_error; }
+
+    bool disassemble(const Disassembler::Progress& progress = nullptr);
+    bool writeGraph();  // outfile + ".mermaid"
+    bool writeExport();
+    bool writeStrings(const std::string& path, bool json, bool unicode);
+
+    // Statistics / 통계
+    long long listingBytes() const { return m_bytes; }
+    size_t functionCount() const { return m_graph.functionCount(); }
+    size_t blockCount() const { return m_graph.blockCount(); }
+    size_t stringCount() const { return m_strings; }
+    bool listingFromCache() const { return m_listingCached; }
+    // Code coverage of the listing, readable from any thread / 목록의 코드 처리량, 모든 스레드에서 읽기 가능
+    const CodeProgress& progress() const { return m_progress; }
+
+private:
+    bool fail(const std::string& message);
+    // Localized message, then ": detail" when given / 지역화된 메시지 뒤에 ": 세부"
+    bool fail(Msg msg, const std::string& detail = std::string());
+    std::string cacheKey(const char* kind, const std::string& options);
+    bool disassembleToFile(const Disassembler::Options& opts, FileSink& out, ResultCache::Writer* store,
+                           const Disassembler::Progress& progress);
+
+    Options m_opts;
+    BinaryInfo m_info;
+    ControlFlowGraph m_graph;
+    Listing m_listing;
+    CodeProgress m_progress;
+    std::string m_error;
+    long long m_bytes = 0;
+    size_t m_strings = 0;
+    uint64_t m_contentHash = 0;
+    int m_hashState = 0; // 0 = not yet, 1 = hashed, -1 = unreadable / 0 = 미계산, 1 = 계산됨, -1 = 읽기 실패
+    bool m_listingCached = false;
+};
+
+#endif
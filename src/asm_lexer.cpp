@@ -0,0 +1,506 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Asm Lexer Implementation - Compile-time perfect hash and the line scanner
+ */
+#include "asm_lexer.h"
+#include <array>
+
+namespace {
+
+enum class Cls : uint8_t { None, Mnemonic, Prefix, Register, Keyword };
+
+struct Word {
+    std::string_view name;
+    Cls cls;
+};
+
+// Lower case, at most kMaxWord characters / 소문자, 최대 kMaxWord자
+constexpr Word kWords[] = {
+    {"mov", Cls::Mnemonic}, {"movzx", Cls::Mnemonic}, {"movsx", Cls::Mnemonic}, {"movsxd", Cls::Mnemonic},
+    {"movabs", Cls::Mnemonic}, {"movbe", Cls::Mnemonic}, {"movnti", Cls::Mnemonic}, {"add", Cls::Mnemonic},
+    {"adc", Cls::Mnemonic}, {"sub", Cls::Mnemonic}, {"sbb", Cls::Mnemonic}, {"imul", Cls::Mnemonic},
+    {"mul", Cls::Mnemonic}, {"idiv", Cls::Mnemonic}, {"div", Cls::Mnemonic}, {"neg", Cls::Mnemonic},
+    {"not", Cls::Mnemonic}, {"and", Cls::Mnemonic}, {"or", Cls::Mnemonic}, {"xor", Cls::Mnemonic},
+    {"test", Cls::Mnemonic}, {"cmp", Cls::Mnemonic}, {"inc", Cls::Mnemonic}, {"dec", Cls::Mnemonic},
+    {"lea", Cls::Mnemonic}, {"push", Cls::Mnemonic}, {"pop", Cls::Mnemonic}, {"pusha", Cls::Mnemonic},
+    {"popa", Cls::Mnemonic}, {"pushf", Cls::Mnemonic}, {"popf", Cls::Mnemonic}, {"pushfq", Cls::Mnemonic},
+    {"popfq", Cls::Mnemonic}, {"call", Cls::Mnemonic}, {"ret", Cls::Mnemonic}, {"retf", Cls::Mnemonic},
+    {"iret", Cls::Mnemonic}, {"iretq", Cls::Mnemonic}, {"jmp", Cls::Mnemonic}, {"jecxz", Cls::Mnemonic},
+    {"jrcxz", Cls::Mnemonic}, {"loop", Cls::Mnemonic}, {"loope", Cls::Mnemonic}, {"loopne", Cls::Mnemonic},
+    {"loopz", Cls::Mnemonic}, {"loopnz", Cls::Mnemonic}, {"nop", Cls::Mnemonic}, {"hlt", Cls::Mnemonic},
+    {"int", Cls::Mnemonic}, {"int3", Cls::Mnemonic}, {"into", Cls::Mnemonic}, {"ud2", Cls::Mnemonic},
+    {"syscall", Cls::Mnemonic}, {"sysret", Cls::Mnemonic}, {"sysenter", Cls::Mnemonic}, {"sysexit", Cls::Mnemonic},
+    {"leave", Cls::Mnemonic}, {"enter", Cls::Mnemonic}, {"cpuid", Cls::Mnemonic}, {"rdtsc", Cls::Mnemonic},
+    {"rdtscp", Cls::Mnemonic}, {"rdrand", Cls::Mnemonic}, {"rdseed", Cls::Mnemonic}, {"pause", Cls::Mnemonic},
+    {"lfence", Cls::Mnemonic}, {"mfence", Cls::Mnemonic}, {"sfence", Cls::Mnemonic}, {"shl", Cls::Mnemonic},
+    {"shr", Cls::Mnemonic}, {"sal", Cls::Mnemonic}, {"sar", Cls::Mnemonic}, {"rol", Cls::Mnemonic},
+    {"ror", Cls::Mnemonic}, {"rcl", Cls::Mnemonic}, {"rcr", Cls::Mnemonic}, {"shld", Cls::Mnemonic},
+    {"shrd", Cls::Mnemonic}, {"bt", Cls::Mnemonic}, {"bts", Cls::Mnemonic}, {"btr", Cls::Mnemonic},
+    {"btc", Cls::Mnemonic}, {"bsf", Cls::Mnemonic}, {"bsr", Cls::Mnemonic}, {"lzcnt", Cls::Mnemonic},
+    {"tzcnt", Cls::Mnemonic}, {"popcnt", Cls::Mnemonic}, {"bswap", Cls::Mnemonic}, {"xchg", Cls::Mnemonic},
+    {"xadd", Cls::Mnemonic}, {"cmpxchg", Cls::Mnemonic}, {"cmpxchg8b", Cls::Mnemonic},
+    {"cmpxchg16b", Cls::Mnemonic}, {"cbw", Cls::Mnemonic}, {"cwde", Cls::Mnemonic}, {"cdqe", Cls::Mnemonic},
+    {"cwd", Cls::Mnemonic}, {"cdq", Cls::Mnemonic}, {"cqo", Cls::Mnemonic}, {"cwtl", Cls::Mnemonic},
+    {"cltq", Cls::Mnemonic}, {"cqto", Cls::Mnemonic}, {"cltd", Cls::Mnemonic}, {"clc", Cls::Mnemonic},
+    {"stc", Cls::Mnemonic}, {"cmc", Cls::Mnemonic}, {"cld", Cls::Mnemonic}, {"std", Cls::Mnemonic},
+    {"cli", Cls::Mnemonic}, {"sti", Cls::Mnemonic}, {"lahf", Cls::Mnemonic}, {"sahf", Cls::Mnemonic},
+    {"movs", Cls::Mnemonic}, {"movsb", Cls::Mnemonic}, {"movsw", Cls::Mnemonic}, {"movsd", Cls::Mnemonic},
+    {"movsq", Cls::Mnemonic}, {"cmps", Cls::Mnemonic}, {"cmpsb", Cls::Mnemonic}, {"cmpsw", Cls::Mnemonic},
+    {"cmpsd", Cls::Mnemonic}, {"cmpsq", Cls::Mnemonic}, {"scas", Cls::Mnemonic}, {"scasb", Cls::Mnemonic},
+    {"scasw", Cls::Mnemonic}, {"scasd", Cls::Mnemonic}, {"scasq", Cls::Mnemonic}, {"lods", Cls::Mnemonic},
+    {"lodsb", Cls::Mnemonic}, {"lodsw", Cls::Mnemonic}, {"lodsd", Cls::Mnemonic}, {"lodsq", Cls::Mnemonic},
+    {"stos", Cls::Mnemonic}, {"stosb", Cls::Mnemonic}, {"stosw", Cls::Mnemonic}, {"stosd", Cls::Mnemonic},
+    {"stosq", Cls::Mnemonic}, {"ins", Cls::Mnemonic}, {"insb", Cls::Mnemonic}, {"insw", Cls::Mnemonic},
+    {"insd", Cls::Mnemonic}, {"outs", Cls::Mnemonic}, {"outsb", Cls::Mnemonic}, {"outsw", Cls::Mnemonic},
+    {"outsd", Cls::Mnemonic}, {"in", Cls::Mnemonic}, {"out", Cls::Mnemonic}, {"xlat", Cls::Mnemonic},
+    {"xlatb", Cls::Mnemonic}, {"andn", Cls::Mnemonic}, {"bextr", Cls::Mnemonic}, {"blsi", Cls::Mnemonic},
+    {"blsmsk", Cls::Mnemonic}, {"blsr", Cls::Mnemonic}, {"bzhi", Cls::Mnemonic}, {"pdep", Cls::Mnemonic},
+    {"pext", Cls::Mnemonic}, {"rorx", Cls::Mnemonic}, {"sarx", Cls::Mnemonic}, {"shlx", Cls::Mnemonic},
+    {"shrx", Cls::Mnemonic}, {"mulx", Cls::Mnemonic}, {"adcx", Cls::Mnemonic}, {"adox", Cls::Mnemonic},
+    {"crc32", Cls::Mnemonic}, {"endbr64", Cls::Mnemonic}, {"endbr32", Cls::Mnemonic}, {"xgetbv", Cls::Mnemonic},
+    {"xsave", Cls::Mnemonic}, {"xrstor", Cls::Mnemonic}, {"prefetch", Cls::Mnemonic},
+    {"prefetcht0", Cls::Mnemonic}, {"prefetcht1", Cls::Mnemonic}, {"prefetcht2", Cls::Mnemonic},
+    {"prefetchnta", Cls::Mnemonic}, {"prefetchw", Cls::Mnemonic}, {"clflush", Cls::Mnemonic},
+    {"clflushopt", Cls::Mnemonic}, {"clwb", Cls::Mnemonic}, {"movd", Cls::Mnemonic}, {"movq", Cls::Mnemonic},
+    {"movdqa", Cls::Mnemonic}, {"movdqu", Cls::Mnemonic}, {"movaps", Cls::Mnemonic}, {"movups", Cls::Mnemonic},
+    {"movapd", Cls::Mnemonic}, {"movupd", Cls::Mnemonic}, {"movss", Cls::Mnemonic}, {"movlps", Cls::Mnemonic},
+    {"movhps", Cls::Mnemonic}, {"movlpd", Cls::Mnemonic}, {"movhpd", Cls::Mnemonic}, {"movhlps", Cls::Mnemonic},
+    {"movlhps", Cls::Mnemonic}, {"movmskps", Cls::Mnemonic}, {"movmskpd", Cls::Mnemonic},
+    {"movntdq", Cls::Mnemonic}, {"movntps", Cls::Mnemonic}, {"addps", Cls::Mnemonic}, {"addpd", Cls::Mnemonic},
+    {"addss", Cls::Mnemonic}, {"addsd", Cls::Mnemonic}, {"subps", Cls::Mnemonic}, {"subpd", Cls::Mnemonic},
+    {"subss", Cls::Mnemonic}, {"subsd", Cls::Mnemonic}, {"mulps", Cls::Mnemonic}, {"mulpd", Cls::Mnemonic},
+    {"mulss", Cls::Mnemonic}, {"mulsd", Cls::Mnemonic}, {"divps", Cls::Mnemonic}, {"divpd", Cls::Mnemonic},
+    {"divss", Cls::Mnemonic}, {"divsd", Cls::Mnemonic}, {"sqrtps", Cls::Mnemonic}, {"sqrtpd", Cls::Mnemonic},
+    {"sqrtss", Cls::Mnemonic}, {"sqrtsd", Cls::Mnemonic}, {"minps", Cls::Mnemonic}, {"minpd", Cls::Mnemonic},
+    {"minss", Cls::Mnemonic}, {"minsd", Cls::Mnemonic}, {"maxps", Cls::Mnemonic}, {"maxpd", Cls::Mnemonic},
+    {"maxss", Cls::Mnemonic}, {"maxsd", Cls::Mnemonic}, {"andps", Cls::Mnemonic}, {"andpd", Cls::Mnemonic},
+    {"andnps", Cls::Mnemonic}, {"andnpd", Cls::Mnemonic}, {"orps", Cls::Mnemonic}, {"orpd", Cls::Mnemonic},
+    {"xorps", Cls::Mnemonic}, {"xorpd", Cls::Mnemonic}, {"cmpps", Cls::Mnemonic}, {"cmppd", Cls::Mnemonic},
+    {"cmpss", Cls::Mnemonic}, {"comiss", Cls::Mnemonic}, {"comisd", Cls::Mnemonic}, {"ucomiss", Cls::Mnemonic},
+    {"ucomisd", Cls::Mnemonic}, {"shufps", Cls::Mnemonic}, {"shufpd", Cls::Mnemonic}, {"unpcklps", Cls::Mnemonic},
+    {"unpckhps", Cls::Mnemonic}, {"unpcklpd", Cls::Mnemonic}, {"unpckhpd", Cls::Mnemonic},
+    {"cvtsi2ss", Cls::Mnemonic}, {"cvtsi2sd", Cls::Mnemonic}, {"cvtss2sd", Cls::Mnemonic},
+    {"cvtsd2ss", Cls::Mnemonic}, {"cvttss2si", Cls::Mnemonic}, {"cvttsd2si", Cls::Mnemonic},
+    {"cvtss2si", Cls::Mnemonic}, {"cvtsd2si", Cls::Mnemonic}, {"cvtdq2ps", Cls::Mnemonic},
+    {"cvtps2dq", Cls::Mnemonic}, {"cvttps2dq", Cls::Mnemonic}, {"cvtdq2pd", Cls::Mnemonic},
+    {"cvtpd2dq", Cls::Mnemonic}, {"cvttpd2dq", Cls::Mnemonic}, {"cvtps2pd", Cls::Mnemonic},
+    {"cvtpd2ps", Cls::Mnemonic}, {"paddb", Cls::Mnemonic}, {"paddw", Cls::Mnemonic}, {"paddd", Cls::Mnemonic},
+    {"paddq", Cls::Mnemonic}, {"psubb", Cls::Mnemonic}, {"psubw", Cls::Mnemonic}, {"psubd", Cls::Mnemonic},
+    {"psubq", Cls::Mnemonic}, {"pmullw", Cls::Mnemonic}, {"pmulld", Cls::Mnemonic}, {"pmuludq", Cls::Mnemonic},
+    {"pmaddwd", Cls::Mnemonic}, {"pand", Cls::Mnemonic}, {"pandn", Cls::Mnemonic}, {"por", Cls::Mnemonic},
+    {"pxor", Cls::Mnemonic}, {"pcmpeqb", Cls::Mnemonic}, {"pcmpeqw", Cls::Mnemonic}, {"pcmpeqd", Cls::Mnemonic},
+    {"pcmpeqq", Cls::Mnemonic}, {"pcmpgtb", Cls::Mnemonic}, {"pcmpgtw", Cls::Mnemonic}, {"pcmpgtd", Cls::Mnemonic},
+    {"pcmpgtq", Cls::Mnemonic}, {"pmovmskb", Cls::Mnemonic}, {"pshufb", Cls::Mnemonic}, {"pshufd", Cls::Mnemonic},
+    {"pshuflw", Cls::Mnemonic}, {"pshufhw", Cls::Mnemonic}, {"punpcklbw", Cls::Mnemonic},
+    {"punpcklwd", Cls::Mnemonic}, {"punpckldq", Cls::Mnemonic}, {"punpcklqdq", Cls::Mnemonic},
+    {"punpckhbw", Cls::Mnemonic}, {"punpckhwd", Cls::Mnemonic}, {"punpckhdq", Cls::Mnemonic},
+    {"punpckhqdq", Cls::Mnemonic}, {"psllw", Cls::Mnemonic}, {"pslld", Cls::Mnemonic}, {"psllq", Cls::Mnemonic},
+    {"pslldq", Cls::Mnemonic}, {"psrlw", Cls::Mnemonic}, {"psrld", Cls::Mnemonic}, {"psrlq", Cls::Mnemonic},
+    {"psrldq", Cls::Mnemonic}, {"psraw", Cls::Mnemonic}, {"psrad", Cls::Mnemonic}, {"packsswb", Cls::Mnemonic},
+    {"packuswb", Cls::Mnemonic}, {"packssdw", Cls::Mnemonic}, {"packusdw", Cls::Mnemonic},
+    {"pminub", Cls::Mnemonic}, {"pmaxub", Cls::Mnemonic}, {"pminsd", Cls::Mnemonic}, {"pmaxsd", Cls::Mnemonic},
+    {"pminud", Cls::Mnemonic}, {"pmaxud", Cls::Mnemonic}, {"ptest", Cls::Mnemonic}, {"pextrb", Cls::Mnemonic},
+    {"pextrw", Cls::Mnemonic}, {"pextrd", Cls::Mnemonic}, {"pextrq", Cls::Mnemonic}, {"pinsrb", Cls::Mnemonic},
+    {"pinsrw", Cls::Mnemonic}, {"pinsrd", Cls::Mnemonic}, {"pinsrq", Cls::Mnemonic}, {"palignr", Cls::Mnemonic},
+    {"pblendw", Cls::Mnemonic}, {"pblendvb", Cls::Mnemonic}, {"blendps", Cls::Mnemonic},
+    {"blendpd", Cls::Mnemonic}, {"blendvps", Cls::Mnemonic}, {"blendvpd", Cls::Mnemonic},
+    {"insertps", Cls::Mnemonic}, {"extractps", Cls::Mnemonic}, {"pcmpistri", Cls::Mnemonic},
+    {"pcmpistrm", Cls::Mnemonic}, {"pcmpestri", Cls::Mnemonic}, {"pcmpestrm", Cls::Mnemonic},
+    {"aesenc", Cls::Mnemonic}, {"aesenclast", Cls::Mnemonic}, {"aesdec", Cls::Mnemonic},
+    {"aesdeclast", Cls::Mnemonic}, {"aesimc", Cls::Mnemonic}, {"aeskeygenassist", Cls::Mnemonic},
+    {"pclmulqdq", Cls::Mnemonic}, {"sha1rnds4", Cls::Mnemonic}, {"sha256rnds2", Cls::Mnemonic},
+    {"roundss", Cls::Mnemonic}, {"roundsd", Cls::Mnemonic}, {"roundps", Cls::Mnemonic}, {"roundpd", Cls::Mnemonic},
+    {"vmovd", Cls::Mnemonic}, {"vmovq", Cls::Mnemonic}, {"vmovdqa", Cls::Mnemonic}, {"vmovdqu", Cls::Mnemonic},
+    {"vmovdqa64", Cls::Mnemonic}, {"vmovdqu8", Cls::Mnemonic}, {"vmovdqu64", Cls::Mnemonic},
+    {"vmovaps", Cls::Mnemonic}, {"vmovups", Cls::Mnemonic}, {"vmovapd", Cls::Mnemonic}, {"vmovupd", Cls::Mnemonic},
+    {"vmovss", Cls::Mnemonic}, {"vmovsd", Cls::Mnemonic}, {"vmovntdq", Cls::Mnemonic}, {"vaddps", Cls::Mnemonic},
+    {"vaddpd", Cls::Mnemonic}, {"vaddss", Cls::Mnemonic}, {"vaddsd", Cls::Mnemonic}, {"vsubps", Cls::Mnemonic},
+    {"vsubpd", Cls::Mnemonic}, {"vsubss", Cls::Mnemonic}, {"vsubsd", Cls::Mnemonic}, {"vmulps", Cls::Mnemonic},
+    {"vmulpd", Cls::Mnemonic}, {"vmulss", Cls::Mnemonic}, {"vmulsd", Cls::Mnemonic}, {"vdivps", Cls::Mnemonic},
+    {"vdivpd", Cls::Mnemonic}, {"vdivss", Cls::Mnemonic}, {"vdivsd", Cls::Mnemonic}, {"vsqrtss", Cls::Mnemonic},
+    {"vsqrtsd", Cls::Mnemonic}, {"vxorps", Cls::Mnemonic}, {"vxorpd", Cls::Mnemonic}, {"vandps", Cls::Mnemonic},
+    {"vandpd", Cls::Mnemonic}, {"vorps", Cls::Mnemonic}, {"vorpd", Cls::Mnemonic}, {"vpxor", Cls::Mnemonic},
+    {"vpor", Cls::Mnemonic}, {"vpand", Cls::Mnemonic}, {"vpandn", Cls::Mnemonic}, {"vpxord", Cls::Mnemonic},
+    {"vpxorq", Cls::Mnemonic}, {"vpternlogd", Cls::Mnemonic}, {"vpternlogq", Cls::Mnemonic},
+    {"vpaddb", Cls::Mnemonic}, {"vpaddw", Cls::Mnemonic}, {"vpaddd", Cls::Mnemonic}, {"vpaddq", Cls::Mnemonic},
+    {"vpsubb", Cls::Mnemonic}, {"vpsubd", Cls::Mnemonic}, {"vpsubq", Cls::Mnemonic}, {"vpcmpeqb", Cls::Mnemonic},
+    {"vpcmpeqd", Cls::Mnemonic}, {"vpcmpeqq", Cls::Mnemonic}, {"vpcmpgtb", Cls::Mnemonic},
+    {"vpminub", Cls::Mnemonic}, {"vpmaxub", Cls::Mnemonic}, {"vpmovmskb", Cls::Mnemonic},
+    {"vpshufb", Cls::Mnemonic}, {"vpshufd", Cls::Mnemonic}, {"vpbroadcastb", Cls::Mnemonic},
+    {"vpbroadcastw", Cls::Mnemonic}, {"vpbroadcastd", Cls::Mnemonic}, {"vpbroadcastq", Cls::Mnemonic},
+    {"vbroadcastss", Cls::Mnemonic}, {"vbroadcastsd", Cls::Mnemonic}, {"vperm2i128", Cls::Mnemonic},
+    {"vpermq", Cls::Mnemonic}, {"vpermd", Cls::Mnemonic}, {"vpermps", Cls::Mnemonic},
+    {"vinserti128", Cls::Mnemonic}, {"vextracti128", Cls::Mnemonic}, {"vinsertf128", Cls::Mnemonic},
+    {"vextractf128", Cls::Mnemonic}, {"vfmadd132ps", Cls::Mnemonic}, {"vfmadd213ps", Cls::Mnemonic},
+    {"vfmadd231ps", Cls::Mnemonic}, {"vfmadd132pd", Cls::Mnemonic}, {"vfmadd213pd", Cls::Mnemonic},
+    {"vfmadd231pd", Cls::Mnemonic}, {"vfmadd231ss", Cls::Mnemonic}, {"vfmadd231sd", Cls::Mnemonic},
+    {"vpcmpb", Cls::Mnemonic}, {"vpcmpub", Cls::Mnemonic}, {"vpcmpeqw", Cls::Mnemonic}, {"vptest", Cls::Mnemonic},
+    {"vzeroupper", Cls::Mnemonic}, {"vzeroall", Cls::Mnemonic}, {"vucomiss", Cls::Mnemonic},
+    {"vucomisd", Cls::Mnemonic}, {"vcvtsi2sd", Cls::Mnemonic}, {"vcvtsi2ss", Cls::Mnemonic},
+    {"vcvttsd2si", Cls::Mnemonic}, {"vcvtss2sd", Cls::Mnemonic}, {"vcvtsd2ss", Cls::Mnemonic},
+    {"kmovb", Cls::Mnemonic}, {"kmovw", Cls::Mnemonic}, {"kmovd", Cls::Mnemonic}, {"kmovq", Cls::Mnemonic},
+    {"kortestw", Cls::Mnemonic}, {"kortestd", Cls::Mnemonic}, {"kortestq", Cls::Mnemonic}, {"fld", Cls::Mnemonic},
+    {"fst", Cls::Mnemonic}, {"fstp", Cls::Mnemonic}, {"fild", Cls::Mnemonic}, {"fist", Cls::Mnemonic},
+    {"fistp", Cls::Mnemonic}, {"fisttp", Cls::Mnemonic}, {"fadd", Cls::Mnemonic}, {"faddp", Cls::Mnemonic},
+    {"fsub", Cls::Mnemonic}, {"fsubp", Cls::Mnemonic}, {"fsubr", Cls::Mnemonic}, {"fsubrp", Cls::Mnemonic},
+    {"fmul", Cls::Mnemonic}, {"fmulp", Cls::Mnemonic}, {"fdiv", Cls::Mnemonic}, {"fdivp", Cls::Mnemonic},
+    {"fdivr", Cls::Mnemonic}, {"fdivrp", Cls::Mnemonic}, {"fchs", Cls::Mnemonic}, {"fabs", Cls::Mnemonic},
+    {"fsqrt", Cls::Mnemonic}, {"fxch", Cls::Mnemonic}, {"fcom", Cls::Mnemonic}, {"fcomp", Cls::Mnemonic},
+    {"fcompp", Cls::Mnemonic}, {"fcomi", Cls::Mnemonic}, {"fcomip", Cls::Mnemonic}, {"fucomi", Cls::Mnemonic},
+    {"fucomip", Cls::Mnemonic}, {"fucom", Cls::Mnemonic}, {"fucomp", Cls::Mnemonic}, {"fucompp", Cls::Mnemonic},
+    {"fldz", Cls::Mnemonic}, {"fld1", Cls::Mnemonic}, {"fldcw", Cls::Mnemonic}, {"fnstcw", Cls::Mnemonic},
+    {"fnstsw", Cls::Mnemonic}, {"fstsw", Cls::Mnemonic}, {"fwait", Cls::Mnemonic}, {"wait", Cls::Mnemonic},
+    {"fninit", Cls::Mnemonic}, {"finit", Cls::Mnemonic}, {"frndint", Cls::Mnemonic}, {"fxam", Cls::Mnemonic},
+    {"ftst", Cls::Mnemonic}, {"fsin", Cls::Mnemonic}, {"fcos", Cls::Mnemonic}, {"fptan", Cls::Mnemonic},
+    {"fpatan", Cls::Mnemonic}, {"fyl2x", Cls::Mnemonic}, {"f2xm1", Cls::Mnemonic}, {"fscale", Cls::Mnemonic},
+    {"fprem", Cls::Mnemonic}, {"fxsave", Cls::Mnemonic}, {"fxrstor", Cls::Mnemonic}, {"emms", Cls::Mnemonic},
+    {"jo", Cls::Mnemonic}, {"jno", Cls::Mnemonic}, {"jb", Cls::Mnemonic}, {"jc", Cls::Mnemonic},
+    {"jnae", Cls::Mnemonic}, {"jae", Cls::Mnemonic}, {"jnb", Cls::Mnemonic}, {"jnc", Cls::Mnemonic},
+    {"je", Cls::Mnemonic}, {"jz", Cls::Mnemonic}, {"jne", Cls::Mnemonic}, {"jnz", Cls::Mnemonic},
+    {"jbe", Cls::Mnemonic}, {"jna", Cls::Mnemonic}, {"ja", Cls::Mnemonic}, {"jnbe", Cls::Mnemonic},
+    {"js", Cls::Mnemonic}, {"jns", Cls::Mnemonic}, {"jp", Cls::Mnemonic}, {"jpe", Cls::Mnemonic},
+    {"jnp", Cls::Mnemonic}, {"jpo", Cls::Mnemonic}, {"jl", Cls::Mnemonic}, {"jnge", Cls::Mnemonic},
+    {"jge", Cls::Mnemonic}, {"jnl", Cls::Mnemonic}, {"jle", Cls::Mnemonic}, {"jng", Cls::Mnemonic},
+    {"jg", Cls::Mnemonic}, {"jnle", Cls::Mnemonic}, {"seto", Cls::Mnemonic}, {"setno", Cls::Mnemonic},
+    {"setb", Cls::Mnemonic}, {"setc", Cls::Mnemonic}, {"setnae", Cls::Mnemonic}, {"setae", Cls::Mnemonic},
+    {"setnb", Cls::Mnemonic}, {"setnc", Cls::Mnemonic}, {"sete", Cls::Mnemonic}, {"setz", Cls::Mnemonic},
+    {"setne", Cls::Mnemonic}, {"setnz", Cls::Mnemonic}, {"setbe", Cls::Mnemonic}, {"setna", Cls::Mnemonic},
+    {"seta", Cls::Mnemonic}, {"setnbe", Cls::Mnemonic}, {"sets", Cls::Mnemonic}, {"setns", Cls::Mnemonic},
+    {"setp", Cls::Mnemonic}, {"setpe", Cls::Mnemonic}, {"setnp", Cls::Mnemonic}, {"setpo", Cls::Mnemonic},
+    {"setl", Cls::Mnemonic}, {"setnge", Cls::Mnemonic}, {"setge", Cls::Mnemonic}, {"setnl", Cls::Mnemonic},
+    {"setle", Cls::Mnemonic}, {"setng", Cls::Mnemonic}, {"setg", Cls::Mnemonic}, {"setnle", Cls::Mnemonic},
+    {"cmovo", Cls::Mnemonic}, {"cmovno", Cls::Mnemonic}, {"cmovb", Cls::Mnemonic}, {"cmovc", Cls::Mnemonic},
+    {"cmovnae", Cls::Mnemonic}, {"cmovae", Cls::Mnemonic}, {"cmovnb", Cls::Mnemonic}, {"cmovnc", Cls::Mnemonic},
+    {"cmove", Cls::Mnemonic}, {"cmovz", Cls::Mnemonic}, {"cmovne", Cls::Mnemonic}, {"cmovnz", Cls::Mnemonic},
+    {"cmovbe", Cls::Mnemonic}, {"cmovna", Cls::Mnemonic}, {"cmova", Cls::Mnemonic}, {"cmovnbe", Cls::Mnemonic},
+    {"cmovs", Cls::Mnemonic}, {"cmovns", Cls::Mnemonic}, {"cmovp", Cls::Mnemonic}, {"cmovpe", Cls::Mnemonic},
+    {"cmovnp", Cls::Mnemonic}, {"cmovpo", Cls::Mnemonic}, {"cmovl", Cls::Mnemonic}, {"cmovnge", Cls::Mnemonic},
+    {"cmovge", Cls::Mnemonic}, {"cmovnl", Cls::Mnemonic}, {"cmovle", Cls::Mnemonic}, {"cmovng", Cls::Mnemonic},
+    {"cmovg", Cls::Mnemonic}, {"cmovnle", Cls::Mnemonic},
+    {"lock", Cls::Prefix}, {"rep", Cls::Prefix}, {"repe", Cls::Prefix}, {"repz", Cls::Prefix},
+    {"repne", Cls::Prefix}, {"repnz", Cls::Prefix}, {"data16", Cls::Prefix}, {"data32", Cls::Prefix},
+    {"addr16", Cls::Prefix}, {"addr32", Cls::Prefix}, {"notrack", Cls::Prefix}, {"bnd", Cls::Prefix},
+    {"rex", Cls::Prefix}, {"rex.w", Cls::Prefix}, {"xacquire", Cls::Prefix}, {"xrelease", Cls::Prefix},
+    {"rax", Cls::Register}, {"eax", Cls::Register}, {"ax", Cls::Register}, {"rbx", Cls::Register},
+    {"ebx", Cls::Register}, {"bx", Cls::Register}, {"rcx", Cls::Register}, {"ecx", Cls::Register},
+    {"cx", Cls::Register}, {"rdx", Cls::Register}, {"edx", Cls::Register}, {"dx", Cls::Register},
+    {"rsi", Cls::Register}, {"esi", Cls::Register}, {"si", Cls::Register}, {"rdi", Cls::Register},
+    {"edi", Cls::Register}, {"di", Cls::Register}, {"rbp", Cls::Register}, {"ebp", Cls::Register},
+    {"bp", Cls::Register}, {"rsp", Cls::Register}, {"esp", Cls::Register}, {"sp", Cls::Register},
+    {"al", Cls::Register}, {"bl", Cls::Register}, {"cl", Cls::Register}, {"dl", Cls::Register},
+    {"ah", Cls::Register}, {"bh", Cls::Register}, {"ch", Cls::Register}, {"dh", Cls::Register},
+    {"sil", Cls::Register}, {"dil", Cls::Register}, {"bpl", Cls::Register}, {"spl", Cls::Register},
+    {"r8", Cls::Register}, {"r8d", Cls::Register}, {"r8w", Cls::Register}, {"r8b", Cls::Register},
+    {"r8l", Cls::Register}, {"r9", Cls::Register}, {"r9d", Cls::Register}, {"r9w", Cls::Register},
+    {"r9b", Cls::Register}, {"r9l", Cls::Register}, {"r10", Cls::Register}, {"r10d", Cls::Register},
+    {"r10w", Cls::Register}, {"r10b", Cls::Register}, {"r10l", Cls::Register}, {"r11", Cls::Register},
+    {"r11d", Cls::Register}, {"r11w", Cls::Register}, {"r11b", Cls::Register}, {"r11l", Cls::Register},
+    {"r12", Cls::Register}, {"r12d", Cls::Register}, {"r12w", Cls::Register}, {"r12b", Cls::Register},
+    {"r12l", Cls::Register}, {"r13", Cls::Register}, {"r13d", Cls::Register}, {"r13w", Cls::Register},
+    {"r13b", Cls::Register}, {"r13l", Cls::Register}, {"r14", Cls::Register}, {"r14d", Cls::Register},
+    {"r14w", Cls::Register}, {"r14b", Cls::Register}, {"r14l", Cls::Register}, {"r15", Cls::Register},
+    {"r15d", Cls::Register}, {"r15w", Cls::Register}, {"r15b", Cls::Register}, {"r15l", Cls::Register},
+    {"rip", Cls::Register}, {"eip", Cls::Register}, {"ip", Cls::Register}, {"cs", Cls::Register},
+    {"ds", Cls::Register}, {"es", Cls::Register}, {"fs", Cls::Register}, {"gs", Cls::Register},
+    {"ss", Cls::Register}, {"st", Cls::Register}, {"cr0", Cls::Register}, {"cr2", Cls::Register},
+    {"cr3", Cls::Register}, {"cr4", Cls::Register}, {"cr8", Cls::Register}, {"dr0", Cls::Register},
+    {"dr1", Cls::Register}, {"dr2", Cls::Register}, {"dr3", Cls::Register}, {"dr6", Cls::Register},
+    {"dr7", Cls::Register}, {"st0", Cls::Register}, {"st1", Cls::Register}, {"st2", Cls::Register},
+    {"st3", Cls::Register}, {"st4", Cls::Register}, {"st5", Cls::Register}, {"st6", Cls::Register},
+    {"st7", Cls::Register}, {"mm0", Cls::Register}, {"mm1", Cls::Register}, {"mm2", Cls::Register},
+    {"mm3", Cls::Register}, {"mm4", Cls::Register}, {"mm5", Cls::Register}, {"mm6", Cls::Register},
+    {"mm7", Cls::Register}, {"k0", Cls::Register}, {"k1", Cls::Register}, {"k2", Cls::Register},
+    {"k3", Cls::Register}, {"k4", Cls::Register}, {"k5", Cls::Register}, {"k6", Cls::Register},
+    {"k7", Cls::Register}, {"xmm0", Cls::Register}, {"xmm1", Cls::Register}, {"xmm2", Cls::Register},
+    {"xmm3", Cls::Register}, {"xmm4", Cls::Register}, {"xmm5", Cls::Register}, {"xmm6", Cls::Register},
+    {"xmm7", Cls::Register}, {"xmm8", Cls::Register}, {"xmm9", Cls::Register}, {"xmm10", Cls::Register},
+    {"xmm11", Cls::Register}, {"xmm12", Cls::Register}, {"xmm13", Cls::Register}, {"xmm14", Cls::Register},
+    {"xmm15", Cls::Register}, {"xmm16", Cls::Register}, {"xmm17", Cls::Register}, {"xmm18", Cls::Register},
+    {"xmm19", Cls::Register}, {"xmm20", Cls::Register}, {"xmm21", Cls::Register}, {"xmm22", Cls::Register},
+    {"xmm23", Cls::Register}, {"xmm24", Cls::Register}, {"xmm25", Cls::Register}, {"xmm26", Cls::Register},
+    {"xmm27", Cls::Register}, {"xmm28", Cls::Register}, {"xmm29", Cls::Register}, {"xmm30", Cls::Register},
+    {"xmm31", Cls::Register}, {"ymm0", Cls::Register}, {"ymm1", Cls::Register}, {"ymm2", Cls::Register},
+    {"ymm3", Cls::Register}, {"ymm4", Cls::Register}, {"ymm5", Cls::Register}, {"ymm6", Cls::Register},
+    {"ymm7", Cls::Register}, {"ymm8", Cls::Register}, {"ymm9", Cls::Register}, {"ymm10", Cls::Register},
+    {"ymm11", Cls::Register}, {"ymm12", Cls::Register}, {"ymm13", Cls::Register}, {"ymm14", Cls::Register},
+    {"ymm15", Cls::Register}, {"ymm16", Cls::Register}, {"ymm17", Cls::Register}, {"ymm18", Cls::Register},
+    {"ymm19", Cls::Register}, {"ymm20", Cls::Register}, {"ymm21", Cls::Register}, {"ymm22", Cls::Register},
+    {"ymm23", Cls::Register}, {"ymm24", Cls::Register}, {"ymm25", Cls::Register}, {"ymm26", Cls::Register},
+    {"ymm27", Cls::Register}, {"ymm28", Cls::Register}, {"ymm29", Cls::Register}, {"ymm30", Cls::Register},
+    {"ymm31", Cls::Register}, {"zmm0", Cls::Register}, {"zmm1", Cls::Register}, {"zmm2", Cls::Register},
+    {"zmm3", Cls::Register}, {"zmm4", Cls::Register}, {"zmm5", Cls::Register}, {"zmm6", Cls::Register},
+    {"zmm7", Cls::Register}, {"zmm8", Cls::Register}, {"zmm9", Cls::Register}, {"zmm10", Cls::Register},
+    {"zmm11", Cls::Register}, {"zmm12", Cls::Register}, {"zmm13", Cls::Register}, {"zmm14", Cls::Register},
+    {"zmm15", Cls::Register}, {"zmm16", Cls::Register}, {"zmm17", Cls::Register}, {"zmm18", Cls::Register},
+    {"zmm19", Cls::Register}, {"zmm20", Cls::Register}, {"zmm21", Cls::Register}, {"zmm22", Cls::Register},
+    {"zmm23", Cls::Register}, {"zmm24", Cls::Register}, {"zmm25", Cls::Register}, {"zmm26", Cls::Register},
+    {"zmm27", Cls::Register}, {"zmm28", Cls::Register}, {"zmm29", Cls::Register}, {"zmm30", Cls::Register},
+    {"zmm31", Cls::Register}, {"riz", Cls::Register}, {"eiz", Cls::Register},
+    {"byte", Cls::Keyword}, {"word", Cls::Keyword}, {"dword", Cls::Keyword}, {"qword", Cls::Keyword},
+    {"tbyte", Cls::Keyword}, {"fword", Cls::Keyword}, {"oword", Cls::Keyword}, {"xmmword", Cls::Keyword},
+    {"ymmword", Cls::Keyword}, {"zmmword", Cls::Keyword}, {"ptr", Cls::Keyword}, {"offset", Cls::Keyword},
+    {"short", Cls::Keyword}, {"near", Cls::Keyword}, {"far", Cls::Keyword},
+};
+
+constexpr size_t kWordCount = sizeof(kWords) / sizeof(kWords[0]);
+constexpr size_t kMaxWord = 16;
+constexpr size_t kSlots = 2048;  // Power of two >= 2x the words / 단어 수 2배 이상의 2의 거듭제곱
+constexpr size_t kBuckets = 512; // About 1.7 words per bucket / 버킷당 약 1.7단어
+static_assert(kWordCount * 2 <= kSlots, "grow kSlots with the word list");
+
+constexpr uint32_t hashWord(std::string_view s, uint32_t seed) {
+    // Seeded FNV-1a with a final avalanche / 시드가 있는 FNV-1a와 마지막 혼합
+    uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+    for (char c : s) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}
+
+/**
+ * Hash-and-displace: words are grouped into buckets by one hash, then each bucket,
+ * largest first, searches for a seed that sends all its words to free slots. A
+ * lookup is two hashes and one comparison, with no probing.
+ * 한 해시로 단어를 버킷에 나눈 뒤, 큰 버킷부터 모든 단어를 빈 슬롯으로 보내는 시드를 찾습니다.
+ * 조회는 해시 두 번과 비교 한 번이며 탐색이 없습니다.
+ */
+struct PerfectHash {
+    std::array<uint16_t, kBuckets> seed{};
+    std::array<int16_t, kSlots> slot{}; // Index into kWords, or -1 / kWords 인덱스 또는 -1
+};
+
+constexpr PerfectHash buildTable() {
+    PerfectHash t{};
+    for (size_t s = 0; s < kSlots; ++s) t.slot[s] = -1;
+
+    // Counting sort of words by bucket / 버킷별 단어 계수 정렬
+    std::array<uint16_t, kBuckets + 1> start{};
+    for (size_t w = 0; w < kWordCount; ++w) ++start[(hashWord(kWords[w].name, 0) & (kBuckets - 1)) + 1];
+    size_t largest = 0;
+    for (size_t b = 0; b < kBuckets; ++b) {
+        largest = start[b + 1] > largest ? start[b + 1] : largest;
+        start[b + 1] += start[b];
+    }
+    std::array<uint16_t, kWordCount> order{};
+    std::array<uint16_t, kBuckets> fill{};
+    for (size_t w = 0; w < kWordCount; ++w) {
+        size_t b = hashWord(kWords[w].name, 0) & (kBuckets - 1);
+        order[start[b] + fill[b]++] = static_cast<uint16_t>(w);
+    }
+
+    for (size_t size = largest; size > 0; --size) {
+        for (size_t b = 0; b < kBuckets; ++b) {
+            if (static_cast<size_t>(start[b + 1] - start[b]) != size) continue;
+            for (uint32_t seed = 1;; ++seed) {
+                std::array<uint16_t, 16> slots{};
+                bool fits = true;
+                for (size_t k = 0; k < size && fits; ++k) {
+                    slots[k] = hashWord(kWords[order[start[b] + k]].name, seed) & (kSlots - 1);
+                    fits = t.slot[slots[k]] < 0;
+                    for (size_t j = 0; j < k && fits; ++j) fits = slots[j] != slots[k];
+                }
+                if (!fits) continue;
+                t.seed[b] = static_cast<uint16_t>(seed);
+                for (size_t k = 0; k < size; ++k) t.slot[slots[k]] = static_cast<int16_t>(order[start[b] + k]);
+                break;
+            }
+        }
+    }
+    return t;
+}
+
+constexpr PerfectHash kTable = buildTable();
+
+constexpr Cls lookupLower(std::string_view word) {
+    uint32_t b = hashWord(word, 0) & (kBuckets - 1);
+    int16_t w = kTable.slot[hashWord(word, kTable.seed[b]) & (kSlots - 1)];
+    return w >= 0 && kWords[w].name == word ? kWords[w].cls : Cls::None;
+}
+
+constexpr bool everyWordFound() {
+    for (size_t w = 0; w < kWordCount; ++w) {
+        if (lookupLower(kWords[w].name) != kWords[w].cls) return false;
+    }
+    return true;
+}
+static_assert(everyWordFound(), "perfect hash must place every word");
+
+Cls classify(std::string_view word) {
+    if (word.size() > kMaxWord) return Cls::None;
+    char lower[kMaxWord];
+    for (size_t i = 0; i < word.size(); ++i) {
+        char c = word[i];
+        lower[i] = c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    return lookupLower(std::string_view(lower, word.size()));
+}
+
+// AT&T adds an operand-size suffix: "movq", "addl", "cmpb" / AT&T의 피연산자 크기 접미사
+Cls classifyMnemonic(std::string_view word) {
+    Cls cls = classify(word);
+    if (cls == Cls::None && word.size() >= 3) {
+        char last = word.back() | 0x20;
+        if (last == 'b' || last == 'w' || last == 'l' || last == 'q' || last == 's' || last == 't') {
+            Cls base = classify(word.substr(0, word.size() - 1));
+            if (base == Cls::Mnemonic) cls = base;
+        }
+    }
+    return cls;
+}
+
+inline bool isHex(char c) {
+    return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f');
+}
+
+inline bool isWordChar(char c) {
+    return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '_' || c == '.' || c == '@';
+}
+
+class Scanner {
+public:
+    Scanner(std::string_view line, AsmLexer::Span* out) : m_s(line), m_out(out) {}
+
+    size_t run() {
+        size_t i = objdumpPrefix();
+        while (i < m_s.size() && m_count < AsmLexer::kMaxSpans) i = token(i);
+        return m_count;
+    }
+
+private:
+    void emit(size_t off, size_t len, AsmLexer::Token token) {
+        if (len > 0 && m_count < AsmLexer::kMaxSpans) {
+            m_out[m_count++] = {static_cast<uint32_t>(off), static_cast<uint32_t>(len), token};
+        }
+    }
+
+    size_t wordEnd(size_t i) const {
+        while (i < m_s.size() && isWordChar(m_s[i])) ++i;
+        return i;
+    }
+
+    // "  401000:\t48 89 e5 \tmov ..." / "0000000000401000 <main>:"
+    size_t objdumpPrefix() {
+        size_t i = 0;
+        while (i < m_s.size() && m_s[i] == ' ') ++i;
+        size_t start = i;
+        while (i < m_s.size() && isHex(m_s[i])) ++i;
+        if (i == start || i >= m_s.size()) return 0;
+        if (m_s[i] == ' ' && i + 1 < m_s.size() && m_s[i + 1] == '<') {
+            emit(start, i - start, AsmLexer::Token::Address);
+            return i;
+        }
+        if (m_s[i] != ':' || i + 1 >= m_s.size() || m_s[i + 1] != '\t') return 0;
+        emit(start, i - start + 1, AsmLexer::Token::Address);
+        i += 2;
+
+        size_t bytes = i;
+        while (i < m_s.size() && m_s[i] != '\t') ++i;
+        size_t bytesEnd = i;
+        while (bytesEnd > bytes && m_s[bytesEnd - 1] == ' ') --bytesEnd;
+        emit(bytes, bytesEnd - bytes, AsmLexer::Token::Bytes);
+        if (i >= m_s.size()) return i;
+
+        // The first word is the mnemonic even when the table does not know it, as is the one after a prefix
+        // 첫 단어는 표에 없어도 니모닉이며, 접두사 뒤의 단어도 마찬가지
+        ++i;
+        for (;;) {
+            while (i < m_s.size() && m_s[i] == ' ') ++i;
+            size_t end = wordEnd(i);
+            if (end == i) return i;
+            emit(i, end - i, AsmLexer::Token::Mnemonic);
+            bool prefix = classify(m_s.substr(i, end - i)) == Cls::Prefix;
+            i = end;
+            if (!prefix) return i;
+        }
+    }
+
+    size_t token(size_t i) {
+        char c = m_s[i];
+        switch (c) {
+        case '#':
+        case ';':
+            emit(i, m_s.size() - i, AsmLexer::Token::Comment);
+            return m_s.size();
+        case '"':
+        case '\'':
+        case '<': {
+            size_t close = m_s.find(c == '<' ? '>' : c, i + 1);
+            if (close == std::string_view::npos) return i + 1;
+            emit(i, close - i + 1, c == '<' ? AsmLexer::Token::Symbol : AsmLexer::Token::String);
+            return close + 1;
+        }
+        case '%': {
+            size_t end = wordEnd(i + 1);
+            if (end > i + 1 && classify(m_s.substr(i + 1, end - i - 1)) == Cls::Register) {
+                emit(i, end - i, AsmLexer::Token::Register);
+            }
+            return end > i + 1 ? end : i + 1;
+        }
+        case '$': {
+            size_t j = i + 1;
+            if (j < m_s.size() && m_s[j] == '-') ++j;
+            size_t end = wordEnd(j);
+            emit(i, end - i, AsmLexer::Token::Immediate);
+            return end > i + 1 ? end : i + 1;
+        }
+        default:
+            break;
+        }
+        size_t end = wordEnd(i);
+        if (end == i) return i + 1;
+        word(i, end);
+        return end;
+    }
+
+    void word(size_t i, size_t end) {
+        std::string_view w = m_s.substr(i, end - i);
+        // Table first, since "fadd" or "cdq" also read as hex / "fadd" 같은 단어도 16진수로 읽히므로 표 우선
+        switch (classifyMnemonic(w)) {
+        case Cls::Mnemonic:
+        case Cls::Prefix: emit(i, w.size(), AsmLexer::Token::Mnemonic); return;
+        case Cls::Register: emit(i, w.size(), AsmLexer::Token::Register); return;
+        case Cls::Keyword: emit(i, w.size(), AsmLexer::Token::Keyword); return;
+        case Cls::None: break;
+        }
+
+        bool hex = true, decimal = true;
+        for (char ch : w) {
+            hex = hex && isHex(ch);
+            decimal = decimal && ch >= '0' && ch <= '9';
+        }
+        if (w.size() > 2 && w[0] == '0' && (w[1] | 0x20) == 'x') {
+            bool digits = true;
+            for (char ch : w.substr(2)) digits = digits && isHex(ch);
+            if (digits) emit(i, w.size(), AsmLexer::Token::Immediate);
+        } else if (hex && w.size() >= 4 && w.size() <= 16) {
+            emit(i, w.size(), AsmLexer::Token::Address);
+        } else if (hex && w.size() == 2) {
+            emit(i, w.size(), AsmLexer::Token::Bytes);
+        } else if (decimal) {
+            emit(i, w.size(), AsmLexer::Token::Immediate);
+        }
+    }
+
+    std::string_view m_s;
+    AsmLexer::Span* m_out;
+    size_t m_count = 0;
+};
+
+} // namespace
+
+size_t AsmLexer::lex(std::string_view line, Span* out) {
+    return Scanner(line, out).run();
+}
+
+bool AsmLexer::isMnemonic(std::string_view word) {
+    Cls cls = classifyMnemonic(word);
+    return cls == Cls::Mnemonic || cls == Cls::Prefix;
+}
+
+bool AsmLexer::isRegister(std::string_view word) {
+    return classify(word) == Cls::Register;
+}
@@ -0,0 +1,53 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Asm Lexer Header - Single-pass tokenizer for objdump and hand-written x86 lines
+ */
+#ifndef ASM_LEXER_H
+#define ASM_LEXER_H
+
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Splits one line into colourable tokens in a single pass / 한 행을 한 번의 순회로 강조용 토큰으로 분할
+ *
+ * objdump's "addr:\tbytes\tmnemonic operands # comment" layout is recognised directly, and
+ * words are classified through a perfect hash of x86 mnemonics, prefixes, registers and
+ * size keywords built at compile time. Both Intel and AT&T ("%reg", "$imm") operands work.
+ * objdump의 "주소:\t바이트\t니모닉 피연산자 # 주석" 배치를 직접 인식하고, 단어는 컴파일 시간에 만든
+ * x86 니모닉, 접두사, 레지스터, 크기 키워드의 완전 해시로 분류합니다. Intel과 AT&T 피연산자를 모두 지원합니다.
+ */
+class AsmLexer {
+public:
+    static constexpr size_t kMaxSpans = 128; // Further tokens on a line stay plain / 그 이후 토큰은 일반 텍스트
+
+    enum class Token : uint8_t {
+        Address,   // "401000:" or a bare 4-16 digit hex word / 4-16자리 16진수 단어
+        Bytes,     // Raw instruction bytes / 명령어 원시 바이트
+        Mnemonic,
+        Register,  // "rax" or "%rax"
+        Keyword,   // Size and pointer words: "qword", "ptr" / 크기, 포인터 키워드
+        Immediate, // "0x10", "42", "$0x10"
+        Symbol,    // "<main+0x10>"
+        String,
+        Comment,   // From '#' or ';' to the end / '#' 또는 ';'부터 끝까지
+        Count
+    };
+
+    // Byte offsets into the line / 행 기준 바이트 오프셋
+    struct Span {
+        uint32_t off;
+        uint32_t len;
+        Token token;
+    };
+
+    // Writes at most kMaxSpans spans in line order and returns how many / 행 순서로 최대 kMaxSpans개 기록 후 개수 반환
+    static size_t lex(std::string_view line, Span* out);
+
+    // Case-insensitive table lookups / 대소문자 구분 없는 표 조회
+    static bool isMnemonic(std::string_view word);
+    static bool isRegister(std::string_view word);
+};
+
+#endif
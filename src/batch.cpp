@@ -0,0 +1,135 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Batch Implementation - Worker pool, output naming and summary
+ */
+#include "batch.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <sys/stat.h>
+#include <dirent.h>
+#include "analysis.h"
+#include "i18n.h"
+
+std::vector<std::string> Batch::collectInputs(const std::string& source) {
+    std::vector<std::string> inputs;
+    if (DIR* dir = opendir(source.c_str())) {
+        while (dirent* ent = readdir(dir)) {
+            if (ent->d_name[0] == '.') continue; // Hidden files, "." and ".." / 숨김 파일, "." 및 ".."
+            std::string path = source + "/" + ent->d_name;
+            struct stat st;
+            if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) inputs.push_back(path);
+        }
+        closedir(dir);
+        std::sort(inputs.begin(), inputs.end());
+        return inputs;
+    }
+
+    // List file: blank lines and '#' comments are skipped / 목록 파일: 빈 행과 '#' 주석은 건너뜀
+    std::ifstream in(source);
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line[begin] == '#') continue;
+        size_t end = line.find_last_not_of(" \t\r");
+        inputs.push_back(line.substr(begin, end - begin + 1));
+    }
+    return inputs;
+}
+
+std::vector<std::string> Batch::outputPaths(const std::vector<std::string>& inputs, const std::string& outDir) {
+    // <outDir>/<basename>.asm; repeated basenames get .2, .3, ... skipping any name already
+    // taken, since a real basename such as "a.2" can collide with a suffixed one
+    // 중복 이름에는 .2, .3, ...을 붙이되 "a.2" 같은 실제 이름과 겹치지 않도록 사용 중인 이름은 건너뜀
+    std::vector<std::string> outputs;
+    outputs.reserve(inputs.size());
+    std::unordered_set<std::string> taken;
+    std::unordered_map<std::string, int> next; // Next suffix to try per basename / 이름별 다음 접미사
+    for (const std::string& input : inputs) {
+        size_t slash = input.find_last_of('/');
+        std::string base = slash == std::string::npos ? input : input.substr(slash + 1);
+        if (base.empty()) base = "input";
+        std::string name = base;
+        int& n = next[base];
+        if (n == 0) n = 2;
+        while (!taken.insert(name).second) name = base + "." + std::to_string(n++);
+        outputs.push_back(outDir + "/" + name + ".asm");
+    }
+    return outputs;
+}
+
+Batch::Result Batch::analyze(const std::string& input, const std::string& output, const Options& opts) {
+    auto start = std::chrono::steady_clock::now();
+    Result r;
+    r.input = input;
+    r.output = output;
+
+    struct stat st;
+    if (stat(input.c_str(), &st) != 0) {
+        r.error = std::string(I18n::instance().get(Msg::FileNotFound)) + ": " + input;
+    } else {
+        Analysis::Options aopts;
+        aopts.infile = input;
+        aopts.outfile = output;
+        aopts.intel = opts.intel;
+        aopts.graph = opts.graph;
+        aopts.jobs = 1; // Parallelism comes from the pool / 병렬성은 풀에서 얻음
+        aopts.cache = opts.cache;
+        Analysis analysis(aopts);
+        std::string stem = output.substr(0, output.size() - 4); // Drop ".asm" / ".asm" 제거
+        // disassemble() fails on objdump's exit status, so the graph and strings files are only
+        // written for inputs it accepted / disassemble()이 objdump 종료 상태로 실패하므로 받아들인 입력만 그래프, 문자열 작성
+        r.ok = analysis.disassemble() && (!opts.graph || analysis.writeGraph()) &&
+               (!opts.strings || analysis.writeStrings(stem + ".strings", opts.json, opts.unicode));
+        r.error = analysis.error();
+        r.cached = analysis.listingFromCache();
+        r.listingBytes = analysis.listingBytes();
+        r.functions = analysis.functionCount();
+        r.blocks = analysis.blockCount();
+        r.strings = analysis.stringCount();
+    }
+    r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return r;
+}
+
+std::vector<Batch::Result> Batch::run(const std::vector<std::string>& inputs, const Options& opts,
+                                      const Report& report) {
+    mkdir(opts.outDir.c_str(), 0755); // Failure surfaces per input / 실패는 입력별로 보고됨
+    std::vector<std::string> outputs = outputPaths(inputs, opts.outDir);
+    std::vector<Result> results(inputs.size());
+
+    unsigned workers = opts.workers ? opts.workers : std::thread::hardware_concurrency();
+    workers = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(workers ? workers : 1, inputs.size())));
+
+    std::atomic<size_t> next{0};
+    std::mutex lock;
+    size_t done = 0;
+    auto work = [&]() {
+        for (size_t k; (k = next.fetch_add(1)) < inputs.size();) {
+            Result r = analyze(inputs[k], outputs[k], opts);
+            std::lock_guard<std::mutex> guard(lock);
+            results[k] = std::move(r);
+            ++done;
+            if (report) report(results[k], done, inputs.size());
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < workers; ++t) pool.emplace_back(work);
+    work(); // The calling thread is a worker too / 호출 스레드도 작업자
+    for (std::thread& t : pool) t.join();
+    return results;
+}
+
+void Batch::writeSummary(std::ostream& out, const std::vector<Result>& results) {
+    out << "input\tstatus\tcached\tseconds\tlisting_bytes\tfunctions\tblocks\tstrings\toutput\terror\n";
+    for (const Result& r : results) {
+        out << r.input << '\t' << (r.ok ? "ok" : "failed") << '\t' << (r.cached ? "yes" : "no") << '\t' << r.seconds << '\t' << r.listingBytes << '\t'
+            << r.functions << '\t' << r.blocks << '\t' << r.strings << '\t' << r.output << '\t' << r.error << '\n';
+    }
+}
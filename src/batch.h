@@ -0,0 +1,68 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Batch Header - Analyze many inputs on a bounded worker pool
+ */
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <functional>
+#include "result_cache.h"
+
+/**
+ * @brief Runs Analysis over a directory or list of inputs / 디렉터리 또는 목록의 입력에 Analysis 실행
+ *
+ * A fixed pool of workers pulls inputs from a shared cursor, so at most `workers`
+ * analyses (and serial objdump processes) are alive at once, and each one streams its
+ * outputs to disk. Results are collected in input order for the summary.
+ * 고정된 작업자 풀이 공유 커서에서 입력을 가져오므로 동시에 최대 workers개의 분석(직렬 objdump)만
+ * 존재하며, 각 분석은 출력을 디스크로 스트리밍합니다. 결과는 요약을 위해 입력 순서로 수집됩니다.
+ */
+class Batch {
+public:
+    struct Options {
+        std::string outDir = "thedecoder-batch";
+        bool intel = false;
+        bool graph = false;
+        bool strings = false; // <name>.strings per input / 입력마다 <이름>.strings
+        bool json = false;    // NDJSON strings / NDJSON 문자열
+        bool unicode = false; // Every encoding, tagged / 모든 인코딩, 태그 표시
+        unsigned workers = 0; // 0 = every hardware thread / 0 = 모든 하드웨어 스레드
+        ResultCache* cache = nullptr; // Shared by every worker / 모든 작업자가 공유
+    };
+
+    struct Result {
+        std::string input;
+        std::string output; // Listing path; side outputs share its stem / 목록 경로, 부가 출력은 같은 이름 사용
+        bool ok = false;
+        bool cached = false; // Listing served from the cache / 캐시에서 제공된 목록
+        std::string error;
+        double seconds = 0;
+        long long listingBytes = 0;
+        size_t functions = 0;
+        size_t blocks = 0;
+        size_t strings = 0;
+    };
+
+    // (result, finished so far, total), called under a lock / 잠금 상태에서 호출
+    using Report = std::function<void(const Result&, size_t, size_t)>;
+
+    // Regular files of a directory (sorted), or one path per line of a list file
+    // 디렉터리의 일반 파일(정렬), 또는 목록 파일의 행마다 경로 하나
+    static std::vector<std::string> collectInputs(const std::string& source);
+
+    // Results are returned in input order / 결과는 입력 순서로 반환
+    static std::vector<Result> run(const std::vector<std::string>& inputs, const Options& opts,
+                                   const Report& report = nullptr);
+
+    // Tab-separated summary, one row per input / 입력마다 한 행의 탭 구분 요약
+    static void writeSummary(std::ostream& out, const std::vector<Result>& results);
+
+private:
+    static std::vector<std::string> outputPaths(const std::vector<std::string>& inputs, const std::string& outDir);
+    static Result analyze(const std::string& input, const std::string& output, const Options& opts);
+};
+
+#endif
@@ -0,0 +1,279 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Binary Header Reader Implementation - Native ELF / PE / Mach-O parsing
+ */
+#include "binary_info.h"
+#include "mapped_file.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// Bounds-checked, endian-aware field reader / 범위 검사 및 엔디언 인식 필드 리더
+struct Reader {
+    const unsigned char* d;
+    size_t n;
+    bool be;
+
+    bool has(uint64_t off, uint64_t len) const { return off <= n && len <= n - off; }
+
+    uint64_t get(uint64_t off, int width) const {
+        if (!has(off, width)) return 0;
+        uint64_t v = 0;
+        for (int i = 0; i < width; ++i) {
+            int shift = be ? (width - 1 - i) * 8 : i * 8;
+            v |= static_cast<uint64_t>(d[off + i]) << shift;
+        }
+        return v;
+    }
+    uint16_t u16(uint64_t off) const { return static_cast<uint16_t>(get(off, 2)); }
+    uint32_t u32(uint64_t off) const { return static_cast<uint32_t>(get(off, 4)); }
+    uint64_t u64(uint64_t off) const { return get(off, 8); }
+    uint64_t word(uint64_t off, bool is64) const { return is64 ? u64(off) : u32(off); }
+
+    std::string str(uint64_t off, size_t maxLen) const {
+        if (off >= n) return "";
+        size_t len = 0;
+        while (len < maxLen && off + len < n && d[off + len]) ++len;
+        return std::string(reinterpret_cast<const char*>(d + off), len);
+    }
+};
+
+std::string elfArch(uint16_t machine) {
+    switch (machine) {
+        case 3: return "i386";
+        case 62: return "x86-64";
+        case 40: return "arm";
+        case 183: return "aarch64";
+        case 243: return "riscv";
+        case 8: return "mips";
+        case 20: return "powerpc";
+        case 21: return "powerpc64";
+        case 2: case 43: return "sparc";
+        case 22: return "s390";
+        case 258: return "loongarch";
+        default: return "unknown";
+    }
+}
+
+std::string peArch(uint16_t machine) {
+    switch (machine) {
+        case 0x14c: return "i386";
+        case 0x8664: return "x86-64";
+        case 0x1c0: case 0x1c2: case 0x1c4: return "arm";
+        case 0xaa64: return "aarch64";
+        case 0x200: return "ia64";
+        default: return "unknown";
+    }
+}
+
+std::string machoArch(uint32_t cpu) {
+    switch (cpu) {
+        case 7: return "i386";
+        case 0x01000007: return "x86-64";
+        case 12: return "arm";
+        case 0x0100000c: return "aarch64";
+        case 18: return "powerpc";
+        case 0x01000012: return "powerpc64";
+        default: return "unknown";
+    }
+}
+}
+
+BinaryInfo BinaryInfo::load(const std::string& path) {
+    BinaryInfo info;
+    MappedFile file(path);
+    if (!file.isOpen() || file.size() < 4) return info;
+
+    const unsigned char* d = file.data();
+    size_t n = file.size();
+    if (d[0] == 0x7f && d[1] == 'E' && d[2] == 'L' && d[3] == 'F') {
+        parseElf(d, n, info);
+    } else if (d[0] == 'M' && d[1] == 'Z') {
+        parsePe(d, n, info);
+    } else {
+        uint32_t magic = Reader{d, n, false}.u32(0);
+        if (magic == 0xfeedface || magic == 0xfeedfacf || magic == 0xcefaedfe || magic == 0xcffaedfe) {
+            parseMachO(d, n, info);
+        }
+    }
+    return info;
+}
+
+void BinaryInfo::parseElf(const unsigned char* d, size_t n, BinaryInfo& info) {
+    if (n < 52) return;
+    bool is64 = d[4] == 2;
+    Reader r{d, n, d[5] == 2};
+    info.format = Format::ELF;
+    info.bits = is64 ? 64 : 32;
+    info.bigEndian = r.be;
+    uint16_t machine = r.u16(18);
+    info.arch = elfArch(machine);
+    info.entry = r.word(24, is64);
+
+    uint64_t shoff = is64 ? r.u64(40) : r.u32(32);
+    uint16_t shentsize = r.u16(is64 ? 58 : 46);
+    uint64_t shnum = r.u16(is64 ? 60 : 48);
+    uint32_t shstrndx = r.u16(is64 ? 62 : 50);
+    if (shoff == 0 || shentsize < (is64 ? 64 : 40)) return;
+
+    auto sh = [&](uint64_t i, int field64, int field32, bool wide) -> uint64_t {
+        uint64_t base = shoff + i * shentsize;
+        return wide ? r.word(base + (is64 ? field64 : field32), is64) : r.u32(base + (is64 ? field64 : field32));
+    };
+    // Extended numbering lives in section header 0 / 확장 번호는 섹션 헤더 0에 저장
+    if (shnum == 0) shnum = sh(0, 32, 20, true);
+    if (shstrndx == 0xffff) shstrndx = static_cast<uint32_t>(sh(0, 40, 24, false));
+    if (!r.has(shoff, shnum * shentsize)) return;
+
+    uint64_t strOff = sh(shstrndx, 24, 16, true);
+    uint64_t symtab = 0, dynsym = 0;
+    for (uint64_t i = 1; i < shnum; ++i) {
+        uint32_t type = static_cast<uint32_t>(sh(i, 4, 4, false));
+        uint64_t flags = sh(i, 8, 8, true);
+        Section s;
+        s.name = r.str(strOff + sh(i, 0, 0, false), 256);
+        s.vma = sh(i, 16, 12, true);
+        s.offset = sh(i, 24, 16, true);
+        s.size = sh(i, 32, 20, true);
+        s.write = flags & 0x1;
+        s.alloc = flags & 0x2;
+        s.exec = flags & 0x4;
+        s.hasContents = type != 8; // SHT_NOBITS
+        if (!s.hasContents) s.offset = 0;
+        info.sections.push_back(s);
+        if (type == 2 && !symtab) symtab = i;
+        if (type == 11 && !dynsym) dynsym = i;
+    }
+
+    // Function symbols for section-aware features / 섹션 인식 기능을 위한 함수 심볼
+    uint64_t symIdx = symtab ? symtab : dynsym;
+    if (!symIdx) return;
+    uint64_t symOff = sh(symIdx, 24, 16, true);
+    uint64_t symSize = sh(symIdx, 32, 20, true);
+    uint64_t entSize = is64 ? 24 : 16;
+    if (!r.has(symOff, symSize)) return;
+    for (uint64_t off = symOff; off + entSize <= symOff + symSize; off += entSize) {
+        uint8_t stInfo = d[off + (is64 ? 4 : 12)];
+        uint16_t shndx = r.u16(off + (is64 ? 6 : 14));
+        uint64_t value = is64 ? r.u64(off + 8) : r.u32(off + 4);
+        uint8_t type = stInfo & 0xf;
+        if ((type != 2 && type != 10) || shndx == 0 || shndx >= 0xff00) continue; // STT_FUNC / STT_GNU_IFUNC
+        if (machine == 40) value &= ~static_cast<uint64_t>(1); // Thumb bit / Thumb 비트
+        info.functions.push_back(value);
+    }
+    std::sort(info.functions.begin(), info.functions.end());
+    info.functions.erase(std::unique(info.functions.begin(), info.functions.end()), info.functions.end());
+}
+
+void BinaryInfo::parsePe(const unsigned char* d, size_t n, BinaryInfo& info) {
+    Reader r{d, n, false};
+    uint64_t pe = r.u32(0x3c);
+    if (!r.has(pe, 24) || std::memcmp(d + pe, "PE\0\0", 4) != 0) return;
+
+    uint64_t coff = pe + 4;
+    uint16_t nsects = r.u16(coff + 2);
+    uint16_t optSize = r.u16(coff + 16);
+    uint64_t opt = coff + 20;
+    uint16_t magic = r.u16(opt);
+    bool is64 = magic == 0x20b;
+
+    info.format = Format::PE;
+    info.arch = peArch(r.u16(coff));
+    info.bits = is64 ? 64 : 32;
+    uint64_t imageBase = is64 ? r.u64(opt + 24) : r.u32(opt + 28);
+    info.entry = imageBase + r.u32(opt + 16);
+
+    uint64_t sec = opt + optSize;
+    for (uint16_t i = 0; i < nsects && r.has(sec, 40); ++i, sec += 40) {
+        uint32_t chars = r.u32(sec + 36);
+        uint32_t virtSize = r.u32(sec + 8);
+        uint32_t rawSize = r.u32(sec + 16);
+        Section s;
+        s.name = r.str(sec, 8);
+        s.vma = imageBase + r.u32(sec + 12);
+        s.size = virtSize ? virtSize : rawSize;
+        s.offset = r.u32(sec + 20);
+        s.alloc = true;
+        s.exec = (chars & 0x20) || (chars & 0x20000000);
+        s.write = chars & 0x80000000;
+        s.hasContents = rawSize > 0 && !(chars & 0x80);
+        info.sections.push_back(s);
+    }
+}
+
+void BinaryInfo::parseMachO(const unsigned char* d, size_t n, BinaryInfo& info) {
+    uint32_t magic = Reader{d, n, false}.u32(0);
+    bool be = magic == 0xcefaedfe || magic == 0xcffaedfe;
+    bool is64 = magic == 0xfeedfacf || magic == 0xcffaedfe;
+    Reader r{d, n, be};
+
+    info.format = Format::MachO;
+    info.bits = is64 ? 64 : 32;
+    info.bigEndian = be;
+    info.arch = machoArch(r.u32(4));
+
+    uint32_t ncmds = r.u32(16);
+    uint64_t cmd = is64 ? 32 : 28;
+    uint64_t textBase = 0;
+    uint64_t entryOff = 0;
+    bool hasMain = false;
+    for (uint32_t i = 0; i < ncmds && r.has(cmd, 8); ++i) {
+        uint32_t type = r.u32(cmd);
+        uint32_t size = r.u32(cmd + 4);
+        if (size < 8) break;
+        if (type == 0x1 || type == 0x19) { // LC_SEGMENT / LC_SEGMENT_64
+            std::string segName = r.str(cmd + 8, 16);
+            uint64_t vmaddr = r.word(cmd + 24, is64);
+            uint64_t fileoff = is64 ? r.u64(cmd + 40) : r.u32(cmd + 32);
+            uint32_t initprot = r.u32(cmd + (is64 ? 60 : 44));
+            uint32_t nsects = r.u32(cmd + (is64 ? 64 : 48));
+            if (fileoff == 0 && segName == "__TEXT") textBase = vmaddr;
+            uint64_t sect = cmd + (is64 ? 72 : 56);
+            uint64_t sectSize = is64 ? 80 : 68;
+            for (uint32_t j = 0; j < nsects && r.has(sect, sectSize); ++j, sect += sectSize) {
+                uint32_t flags = r.u32(sect + (is64 ? 64 : 56));
+                Section s;
+                s.name = r.str(sect + 16, 16) + "." + r.str(sect, 16);
+                s.vma = r.word(sect + 32, is64);
+                s.size = r.word(sect + (is64 ? 40 : 36), is64);
+                s.offset = r.u32(sect + (is64 ? 48 : 40));
+                s.alloc = true;
+                s.exec = (flags & 0x80000000) || (flags & 0x400);
+                s.write = initprot & 0x2;
+                s.hasContents = (flags & 0xff) != 0x1; // S_ZEROFILL
+                if (!s.hasContents) s.offset = 0;
+                info.sections.push_back(s);
+            }
+        } else if (type == 0x80000028) { // LC_MAIN
+            entryOff = r.u64(cmd + 8);
+            hasMain = true;
+        }
+        cmd += size;
+    }
+    if (hasMain) info.entry = textBase + entryOff;
+}
+
+std::string BinaryInfo::formatName() const {
+    std::string bitsStr = std::to_string(bits);
+    switch (format) {
+        case Format::ELF: return "ELF" + bitsStr;
+        case Format::PE: return bits == 64 ? "PE32+" : "PE32";
+        case Format::MachO: return "Mach-O " + bitsStr;
+        default: return "unknown";
+    }
+}
+
+std::vector<BinaryInfo::Section> BinaryInfo::codeSections() const {
+    std::vector<Section> code;
+    for (const Section& s : sections) {
+        if (s.exec && s.hasContents && s.size > 0) code.push_back(s);
+    }
+    return code;
+}
+
+const BinaryInfo::Section* BinaryInfo::sectionAt(uint64_t vma) const {
+    for (const Section& s : sections) {
+        if (s.alloc && s.size > 0 && vma >= s.vma && vma - s.vma < s.size) return &s;
+    }
+    return nullptr;
+}
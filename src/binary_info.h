@@ -0,0 +1,58 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Binary Header Reader - Native ELF / PE / Mach-O parsing
+ */
+#ifndef BINARY_INFO_H
+#define BINARY_INFO_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Architecture, section table and entry point read straight from the headers
+ * 헤더에서 직접 읽은 아키텍처, 섹션 테이블, 진입점
+ */
+class BinaryInfo {
+public:
+    enum class Format { Unknown, ELF, PE, MachO };
+
+    struct Section {
+        std::string name;
+        uint64_t vma = 0;
+        uint64_t size = 0;
+        uint64_t offset = 0; // File offset, 0 when the section has no file contents / 파일 오프셋
+        bool alloc = false;
+        bool exec = false;
+        bool write = false;
+        bool hasContents = false;
+    };
+
+    Format format = Format::Unknown;
+    std::string arch = "unknown"; // "x86-64", "i386", "arm", "aarch64", ...
+    int bits = 0;
+    bool bigEndian = false;
+    uint64_t entry = 0;
+    std::vector<Section> sections; // In header order / 헤더 순서
+    std::vector<uint64_t> functions; // Sorted function symbol addresses (ELF) / 정렬된 함수 심볼 주소
+
+    /**
+     * Maps the file and parses its headers. Unrecognised files yield Format::Unknown.
+     * 파일을 매핑하여 헤더를 파싱합니다. 인식할 수 없는 파일은 Format::Unknown을 반환합니다.
+     */
+    static BinaryInfo load(const std::string& path);
+
+    bool isX86() const { return arch == "x86-64" || arch == "i386"; }
+    std::string formatName() const;
+
+    // Executable sections with file contents, in header order / 내용이 있는 실행 섹션
+    std::vector<Section> codeSections() const;
+    const Section* sectionAt(uint64_t vma) const;
+
+private:
+    static void parseElf(const unsigned char* d, size_t n, BinaryInfo& info);
+    static void parsePe(const unsigned char* d, size_t n, BinaryInfo& info);
+    static void parseMachO(const unsigned char* d, size_t n, BinaryInfo& info);
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef BYTE_RING_H
+#define BYTE_RING_H
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+/**
+ * @brief Bounded byte ring between one producer and one consumer thread
+ * 생산자 스레드 하나와 소비자 스레드 하나 사이의 고정 크기 바이트 링
+ * The producer blocks while the ring is full, which throttles objdump instead of
+ * growing memory; the consumer takes everything available in one batch.
+ * 링이 가득 차면 생산자가 대기하여 메모리 대신 objdump 속도를 조절하며, 소비자는 쌓인 데이터를 한 번에 가져갑니다.
+ * Rheehose (Rhee Creative) 2008-2026
+ */
+
+class ByteRing {
+public:
+    explicit ByteRing(size_t capacity) : m_buf(capacity) {}
+
+    // False once the ring is closed / 링이 닫히면 false
+    bool write(const char* data, size_t len) {
+        std::unique_lock<std::mutex> lock(m_lock);
+        while (len > 0) {
+            m_space.wait(lock, [this]() { return m_closed || m_used < m_buf.size(); });
+            if (m_closed) return false;
+            size_t n = std::min(len, m_buf.size() - m_used);
+            size_t tail = (m_head + m_used) % m_buf.size();
+            size_t first = std::min(n, m_buf.size() - tail);
+            std::memcpy(&m_buf[tail], data, first);
+            std::memcpy(&m_buf[0], data + first, n - first);
+            m_used += n;
+            data += n;
+            len -= n;
+            m_data.notify_one();
+        }
+        return true;
+    }
+
+    // Waits for data and copies up to max bytes; 0 means closed and drained
+    // 데이터를 기다려 최대 max 바이트를 복사, 0이면 닫히고 비워진 상태
+    size_t read(char* out, size_t max) {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_data.wait(lock, [this]() { return m_closed || m_used > 0; });
+        size_t n = std::min(max, m_used);
+        size_t first = std::min(n, m_buf.size() - m_head);
+        std::memcpy(out, &m_buf[m_head], first);
+        std::memcpy(out + first, &m_buf[0], n - first);
+        m_head = (m_head + n) % m_buf.size();
+        m_used -= n;
+        m_space.notify_one();
+        return n;
+    }
+
+    // Wakes both sides; buffered data can still be read / 양쪽을 깨우며 남은 데이터는 계속 읽을 수 있음
+    void close() {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_closed = true;
+        m_data.notify_all();
+        m_space.notify_all();
+    }
+
+private:
+    std::vector<char> m_buf;
+    size_t m_head = 0;
+    size_t m_used = 0;
+    bool m_closed = false;
+    std::mutex m_lock;
+    std::condition_variable m_data;
+    std::condition_variable m_space;
+};
+
+#endif // BYTE_RING_H
@@ -0,0 +1,170 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Control Flow Graph Implementation - Block splitting and CSR edge building
+ */
+#include "control_flow.h"
+#include <algorithm>
+
+namespace {
+constexpr uint8_t kEndsBlock = Listing::Jump | Listing::CondJump | Listing::Return;
+constexpr uint8_t kBranch = Listing::Jump | Listing::CondJump;
+}
+
+void ControlFlowGraph::beginFunction(std::string_view name) {
+    uint32_t sym = internSymbol(name);
+    uint32_t fn = static_cast<uint32_t>(m_functionSymbol.size());
+    m_functionSymbol.push_back(sym);
+    m_functionFirstInsn.push_back(static_cast<uint32_t>(m_insnAddress.size()));
+    // First definition wins for duplicate names / 이름이 중복되면 첫 정의 사용
+    if (m_symbolFunction[sym] == npos) m_symbolFunction[sym] = fn;
+}
+
+void ControlFlowGraph::addInstruction(uint64_t address, uint8_t flags, std::string_view targetSymbol, uint64_t target) {
+    if (m_functionSymbol.empty()) return; // Outside any function / 함수 밖의 명령어
+    m_insnAddress.push_back(address);
+    m_insnTarget.push_back(target);
+    m_insnSymbol.push_back(targetSymbol.empty() ? npos : internSymbol(targetSymbol));
+    m_insnFlags.push_back(flags);
+}
+
+void ControlFlowGraph::addRecord(const Listing::Fields& f) {
+    if (f.kind == Listing::Kind::Function) {
+        beginFunction(f.name);
+    } else if (f.kind == Listing::Kind::Instruction) {
+        addInstruction(f.address, f.flags, f.symbol, f.target);
+    }
+}
+
+void ControlFlowGraph::addRow(const Listing& listing, size_t row) {
+    Listing::Kind kind = listing.kind(row);
+    uint32_t sym = listing.symbolRef(row);
+    if (kind == Listing::Kind::Function) {
+        beginFunction(listing.symbolName(sym));
+    } else if (kind == Listing::Kind::Instruction) {
+        addInstruction(listing.address(row), listing.mnemonicFlags(listing.mnemonicId(row)),
+                       sym == Listing::npos ? std::string_view() : listing.symbolName(sym),
+                       listing.target(row));
+    }
+}
+
+ControlFlowGraph ControlFlowGraph::fromListing(const Listing& listing) {
+    ControlFlowGraph graph;
+    for (size_t row = 0; row < listing.size(); ++row) {
+        graph.addRow(listing, row);
+    }
+    graph.finalize();
+    return graph;
+}
+
+uint32_t ControlFlowGraph::internSymbol(std::string_view s) {
+    uint32_t id = m_symbols.intern(s);
+    if (id == m_symbolFunction.size()) m_symbolFunction.push_back(npos);
+    return id;
+}
+
+uint32_t ControlFlowGraph::resolveInstruction(uint32_t symbol, uint64_t target) const {
+    // The symbol names the function, the address picks the instruction inside it
+    // 심볼로 함수를 찾고 주소로 그 안의 명령어를 찾습니다
+    if (symbol == npos) return npos;
+    uint32_t fn = m_symbolFunction[symbol];
+    if (fn == npos) return npos;
+    auto first = m_insnAddress.begin() + m_functionFirstInsn[fn];
+    auto last = m_insnAddress.begin() + m_functionFirstInsn[fn + 1];
+    auto it = std::lower_bound(first, last, target);
+    if (it == last || *it != target) return npos;
+    return static_cast<uint32_t>(it - m_insnAddress.begin());
+}
+
+uint32_t ControlFlowGraph::blockOfInstruction(uint32_t insn) const {
+    auto it = std::upper_bound(m_blockFirstInsn.begin(), m_blockFirstInsn.end() - 1, insn);
+    return static_cast<uint32_t>(it - m_blockFirstInsn.begin()) - 1;
+}
+
+void ControlFlowGraph::addEdge(uint32_t first, uint32_t target, EdgeKind kind, uint32_t symbol) {
+    for (size_t e = first; e < m_edgeTarget.size(); ++e) {
+        if (m_edgeTarget[e] == target && m_edgeKind[e] == static_cast<uint8_t>(kind) &&
+            (target != npos || m_edgeSymbol[e] == symbol)) return;
+    }
+    m_edgeTarget.push_back(target);
+    m_edgeKind.push_back(static_cast<uint8_t>(kind));
+    m_edgeSymbol.push_back(symbol);
+}
+
+void ControlFlowGraph::finalize() {
+    if (m_finalized) return;
+    m_finalized = true;
+
+    uint32_t n = static_cast<uint32_t>(m_insnAddress.size());
+    uint32_t fnCount = static_cast<uint32_t>(m_functionSymbol.size());
+    m_functionFirstInsn.push_back(n);
+
+    // Resolve branch and call targets once / 분기와 호출 대상을 한 번만 해석
+    std::vector<uint32_t> resolved(n, npos);
+    for (uint32_t i = 0; i < n; ++i) {
+        if (m_insnFlags[i] & (kBranch | Listing::Call)) resolved[i] = resolveInstruction(m_insnSymbol[i], m_insnTarget[i]);
+    }
+
+    // Leaders: function entries, branch targets, instructions after jumps and returns
+    // 리더: 함수 진입점, 분기 대상, 점프/반환 다음 명령어
+    std::vector<uint8_t> leader(n, 0);
+    for (uint32_t fn = 0; fn < fnCount; ++fn) {
+        if (m_functionFirstInsn[fn] < m_functionFirstInsn[fn + 1]) leader[m_functionFirstInsn[fn]] = 1;
+    }
+    for (uint32_t i = 0; i < n; ++i) {
+        uint8_t flags = m_insnFlags[i];
+        if ((flags & kEndsBlock) && i + 1 < n) leader[i + 1] = 1;
+        if ((flags & kBranch) && resolved[i] != npos) leader[resolved[i]] = 1;
+    }
+
+    m_functionFirstBlock.reserve(fnCount + 1);
+    for (uint32_t fn = 0; fn < fnCount; ++fn) {
+        m_functionFirstBlock.push_back(static_cast<uint32_t>(m_blockAddress.size()));
+        for (uint32_t i = m_functionFirstInsn[fn]; i < m_functionFirstInsn[fn + 1]; ++i) {
+            if (!leader[i]) continue;
+            m_blockFirstInsn.push_back(i);
+            m_blockAddress.push_back(m_insnAddress[i]);
+            m_blockFunction.push_back(fn);
+        }
+    }
+    m_functionFirstBlock.push_back(static_cast<uint32_t>(m_blockAddress.size()));
+    m_blockFirstInsn.push_back(n);
+
+    // CSR edges, emitted block by block / 블록 순서대로 CSR 간선 생성
+    uint32_t blocks = static_cast<uint32_t>(m_blockAddress.size());
+    m_edgeOffset.reserve(blocks + 1);
+    m_edgeOffset.push_back(0);
+    for (uint32_t b = 0; b < blocks; ++b) {
+        uint32_t first = static_cast<uint32_t>(m_edgeTarget.size());
+        uint32_t begin = m_blockFirstInsn[b];
+        uint32_t last = m_blockFirstInsn[b + 1] - 1;
+        uint32_t fn = m_blockFunction[b];
+
+        for (uint32_t i = begin; i <= last; ++i) {
+            if ((m_insnFlags[i] & Listing::Call) && m_insnSymbol[i] != npos) {
+                uint32_t target = resolved[i] == npos ? npos : blockOfInstruction(resolved[i]);
+                addEdge(first, target, EdgeKind::Call, m_insnSymbol[i]);
+            }
+        }
+
+        uint8_t flags = m_insnFlags[last];
+        uint32_t target = resolved[last] == npos ? npos : blockOfInstruction(resolved[last]);
+        bool hasNext = b + 1 < m_functionFirstBlock[fn + 1];
+        if (flags & Listing::Return) {
+            // No successors / 후속 블록 없음
+        } else if (flags & Listing::Jump) {
+            if (m_insnSymbol[last] != npos) addEdge(first, target, EdgeKind::Jump, m_insnSymbol[last]);
+        } else {
+            if ((flags & Listing::CondJump) && m_insnSymbol[last] != npos) {
+                addEdge(first, target, EdgeKind::Taken, m_insnSymbol[last]);
+            }
+            if (hasNext) addEdge(first, b + 1, EdgeKind::Fallthrough, npos);
+        }
+        m_edgeOffset.push_back(static_cast<uint32_t>(m_edgeTarget.size()));
+    }
+
+    // Per-instruction input is no longer needed / 명령어별 입력은 더 이상 필요 없음
+    std::vector<uint64_t>().swap(m_insnAddress);
+    std::vector<uint64_t>().swap(m_insnTarget);
+    std::vector<uint32_t>().swap(m_insnSymbol);
+    std::vector<uint8_t>().swap(m_insnFlags);
+}
@@ -0,0 +1,98 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Control Flow Graph Header - Basic blocks with CSR adjacency
+ */
+#ifndef CONTROL_FLOW_H
+#define CONTROL_FLOW_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "listing.h"
+#include "symbol_table.h"
+
+/**
+ * @brief Basic-block control flow graph / 기본 블록 제어 흐름 그래프
+ *
+ * Instructions are fed in listing order, then finalize() splits each function at
+ * branch targets and after jumps/returns. Blocks and edges are plain integer ids;
+ * successors of block b are edges [edgeBegin(b), edgeEnd(b)) in a CSR layout.
+ * 명령어를 목록 순서로 입력한 뒤 finalize()가 분기 대상과 점프/반환 뒤에서 블록을 나눕니다.
+ * 블록과 간선은 정수 id이며 후속 블록은 CSR 배열에 저장됩니다.
+ */
+class ControlFlowGraph {
+public:
+    static constexpr uint32_t npos = 0xffffffffu;
+
+    enum class EdgeKind : uint8_t {
+        Fallthrough, // Next block in the same function / 같은 함수의 다음 블록
+        Jump,        // Unconditional jump / 무조건 점프
+        Taken,       // Conditional branch taken / 조건 분기 성립
+        Call         // Call site to a callee entry / 호출 대상 진입점
+    };
+
+    // Input, in listing order / 목록 순서대로 입력
+    void beginFunction(std::string_view name);
+    void addInstruction(uint64_t address, uint8_t flags, std::string_view targetSymbol, uint64_t target);
+    void addRecord(const Listing::Fields& fields);
+    void addRow(const Listing& listing, size_t row);
+    void finalize();
+
+    static ControlFlowGraph fromListing(const Listing& listing);
+
+    // Functions / 함수
+    size_t functionCount() const { return m_functionSymbol.size(); }
+    std::string_view functionName(uint32_t fn) const { return m_symbols.name(m_functionSymbol[fn]); }
+    uint32_t functionBlockBegin(uint32_t fn) const { return m_functionFirstBlock[fn]; }
+    uint32_t functionBlockEnd(uint32_t fn) const { return m_functionFirstBlock[fn + 1]; }
+
+    // Blocks / 블록
+    size_t blockCount() const { return m_blockAddress.size(); }
+    uint64_t blockAddress(uint32_t b) const { return m_blockAddress[b]; }
+    uint32_t blockFunction(uint32_t b) const { return m_blockFunction[b]; }
+    uint32_t blockInstructions(uint32_t b) const { return m_blockFirstInsn[b + 1] - m_blockFirstInsn[b]; }
+
+    // Edges / 간선
+    size_t edgeCount() const { return m_edgeTarget.size(); }
+    uint32_t edgeBegin(uint32_t b) const { return m_edgeOffset[b]; }
+    uint32_t edgeEnd(uint32_t b) const { return m_edgeOffset[b + 1]; }
+    uint32_t edgeTarget(uint32_t e) const { return m_edgeTarget[e]; } // npos for external symbols / 외부 심볼은 npos
+    EdgeKind edgeKind(uint32_t e) const { return static_cast<EdgeKind>(m_edgeKind[e]); }
+    uint32_t edgeSymbol(uint32_t e) const { return m_edgeSymbol[e]; }
+
+    size_t symbolCount() const { return m_symbols.size(); }
+    std::string_view symbolName(uint32_t id) const { return m_symbols.name(id); }
+
+private:
+    uint32_t internSymbol(std::string_view s);
+    uint32_t resolveInstruction(uint32_t symbol, uint64_t target) const;
+    uint32_t blockOfInstruction(uint32_t insn) const;
+    void addEdge(uint32_t first, uint32_t target, EdgeKind kind, uint32_t symbol);
+
+    // Per-instruction input, released by finalize() / 명령어별 입력, finalize()에서 해제
+    std::vector<uint64_t> m_insnAddress;
+    std::vector<uint64_t> m_insnTarget;
+    std::vector<uint32_t> m_insnSymbol;
+    std::vector<uint8_t> m_insnFlags;
+
+    SymbolTable m_symbols;
+    std::vector<uint32_t> m_symbolFunction; // Symbol id -> function / 심볼 id -> 함수
+
+    std::vector<uint32_t> m_functionSymbol;
+    std::vector<uint32_t> m_functionFirstInsn;
+    std::vector<uint32_t> m_functionFirstBlock;
+
+    std::vector<uint32_t> m_blockFirstInsn;
+    std::vector<uint64_t> m_blockAddress;
+    std::vector<uint32_t> m_blockFunction;
+
+    std::vector<uint32_t> m_edgeOffset;
+    std::vector<uint32_t> m_edgeTarget;
+    std::vector<uint32_t> m_edgeSymbol;
+    std::vector<uint8_t> m_edgeKind;
+
+    bool m_finalized = false;
+};
+
+#endif
@@ -0,0 +1,398 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Disassembler Implementation - objdump driver with parallel address-range sharding
+ */
+#include "disassembler.h"
+#include "binary_info.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace {
+const size_t kChunkSize = 1 << 20;
+const int kPipeSize = 1 << 20; // Fewer wakeups per megabyte / 메가바이트당 깨우기 감소
+
+// Exit code of the child, 128 + signal if it was killed (as shells report it), or kNotStarted
+// 자식의 종료 코드, 시그널로 종료되면 셸처럼 128 + 시그널, 실패 시 kNotStarted
+int reap(pid_t pid) {
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) return Disassembler::kNotStarted;
+    }
+    if (WIFEXITED(status)) return WEXITSTATUS(status);
+    if (WIFSIGNALED(status)) return 128 + WTERMSIG(status);
+    return Disassembler::kNotStarted;
+}
+
+bool writeAll(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = ::write(fd, data, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool cancelled(const Disassembler::Options& opts) {
+    return opts.cancel && opts.cancel->load(std::memory_order_relaxed);
+}
+
+// More objdump workers than cores only contend for them / 코어보다 많은 작업자는 경합만 늘림
+int clampJobs(int jobs) {
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return cores > 0 ? std::min(jobs, cores) : jobs;
+}
+
+std::string hex(uint64_t v) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "0x%llx", static_cast<unsigned long long>(v));
+    return buf;
+}
+
+// One address range handled by a worker / 작업자가 처리하는 하나의 주소 범위
+struct Shard {
+    bool hasStart = false;
+    bool hasStop = false;
+    uint64_t start = 0;
+    uint64_t stop = 0;
+    bool continuesSection = false; // Starts mid-section / 섹션 중간에서 시작
+    FILE* out = nullptr;
+    bool done = false;
+    bool failed = false; // Not started, or its output could not be kept / 시작 실패 또는 출력 보관 실패
+    int code = 0;        // objdump exit code / objdump 종료 코드
+};
+}
+
+std::vector<std::string> Disassembler::baseArgs(const Options& opts) {
+    std::vector<std::string> args = {"objdump", "-d"};
+    if (opts.intel) args.push_back("-Mintel");
+    return args;
+}
+
+int Disassembler::spawn(const std::vector<std::string>& args, int errorFd, pid_t& pid) {
+    // No shell in between, and O_CLOEXEC keeps the pipe out of concurrently spawned workers
+    // 셸을 거치지 않으며, O_CLOEXEC로 동시에 생성되는 작업자에 파이프가 새지 않음
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0) return -1;
+    fcntl(fds[0], F_SETPIPE_SZ, kPipeSize); // Best effort / 최선 노력
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    if (errorFd >= 0) posix_spawn_file_actions_adddup2(&actions, errorFd, STDERR_FILENO);
+    std::vector<char*> argv;
+    for (const std::string& a : args) argv.push_back(const_cast<char*>(a.c_str()));
+    argv.push_back(nullptr);
+    int rc = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    ::close(fds[1]);
+    if (rc != 0) {
+        ::close(fds[0]);
+        return -1;
+    }
+    return fds[0];
+}
+
+int Disassembler::run(const Options& opts, OutputSink& sink, const Progress& progress) {
+    int jobs = clampJobs(opts.jobs);
+    if (jobs > 1) {
+        std::vector<uint64_t> bounds = planShards(opts.file, jobs * 4);
+        if (!bounds.empty()) return runSharded(opts, bounds, sink, progress);
+    }
+    return runSerial(opts, sink, progress);
+}
+
+int Disassembler::runSerial(const Options& opts, OutputSink& sink, const Progress& progress) {
+    std::vector<std::string> args = baseArgs(opts);
+    args.push_back(opts.file);
+    pid_t pid;
+    int in = spawn(args, opts.errorFd, pid);
+    if (in < 0) return kNotStarted;
+
+    std::vector<char> buffer(kChunkSize);
+    long long processed = 0;
+    ssize_t n;
+    while ((n = ::read(in, buffer.data(), buffer.size())) > 0 || (n < 0 && errno == EINTR)) {
+        if (n < 0) continue;
+        if (cancelled(opts)) {
+            kill(pid, SIGTERM);
+            break;
+        }
+        sink.write(buffer.data(), static_cast<size_t>(n));
+        processed += n;
+        if (progress) progress(processed);
+    }
+    ::close(in);
+    int code = reap(pid);
+    sink.flush();
+    return cancelled(opts) ? 0 : code;
+}
+
+int Disassembler::runToFile(const Options& opts, int fd, bool& written, const Progress& progress) {
+    written = true;
+    int jobs = clampJobs(opts.jobs);
+    if (jobs > 1) {
+        std::vector<uint64_t> bounds = planShards(opts.file, jobs * 4);
+        if (!bounds.empty()) {
+            FileSink sink(fd);
+            int code = runSharded(opts, bounds, sink, progress);
+            sink.close();
+            written = sink.good();
+            return code;
+        }
+    }
+
+    std::vector<std::string> args = baseArgs(opts);
+    args.push_back(opts.file);
+    pid_t pid;
+    int in = spawn(args, opts.errorFd, pid);
+    if (in < 0) return kNotStarted;
+
+    long long processed = 0;
+    bool spliced = true;
+    std::vector<char> buffer;
+    for (;;) {
+        ssize_t n;
+        if (spliced) {
+            n = splice(in, nullptr, fd, nullptr, kChunkSize, SPLICE_F_MOVE | SPLICE_F_MORE);
+            // Targets without splice support (O_APPEND, some filesystems) refuse it up front
+            // splice를 지원하지 않는 대상은 처음부터 거부함
+            if (n < 0 && (errno == EINVAL || errno == ENOSYS)) {
+                spliced = false;
+                continue;
+            }
+        } else {
+            if (buffer.empty()) buffer.resize(kChunkSize);
+            n = ::read(in, buffer.data(), buffer.size());
+            if (n > 0 && !writeAll(fd, buffer.data(), static_cast<size_t>(n))) {
+                written = false;
+                break;
+            }
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && spliced) written = false; // splice reports write errors too / splice는 쓰기 오류도 보고
+        if (n <= 0) break;
+        processed += n;
+        if (progress) progress(processed);
+        if (cancelled(opts)) {
+            kill(pid, SIGTERM);
+            break;
+        }
+    }
+    ::close(in); // objdump gets SIGPIPE if it was cut short / 중단 시 objdump는 SIGPIPE를 받음
+    int code = reap(pid);
+    return cancelled(opts) ? 0 : code;
+}
+
+std::vector<uint64_t> Disassembler::planShards(const std::string& file, int shards) {
+    std::vector<uint64_t> bounds;
+    if (shards < 2) return bounds;
+
+    BinaryInfo info = BinaryInfo::load(file);
+    std::vector<BinaryInfo::Section> code = info.codeSections();
+    if (code.empty() || info.functions.size() < 2) return bounds;
+
+    // Sharding relies on header order matching ascending, disjoint addresses
+    // 샤딩은 헤더 순서가 오름차순의 겹치지 않는 주소와 일치해야 합니다
+    for (size_t i = 1; i < code.size(); ++i) {
+        if (code[i].vma < code[i - 1].vma + code[i - 1].size) return bounds;
+    }
+
+    std::vector<uint64_t> starts;
+    for (uint64_t addr : info.functions) {
+        const BinaryInfo::Section* s = info.sectionAt(addr);
+        if (s && s->exec) starts.push_back(addr);
+    }
+    if (starts.size() < 2) return bounds;
+
+    uint64_t total = 0;
+    for (const auto& s : code) total += s.size;
+
+    // Split code bytes evenly, snapping each cut to the next function start
+    // 코드 바이트를 균등 분할하고 각 경계를 다음 함수 시작으로 맞춤
+    for (int k = 1; k < shards; ++k) {
+        uint64_t offset = total * k / shards;
+        uint64_t target = code.back().vma + code.back().size;
+        for (const auto& s : code) {
+            if (offset < s.size) {
+                target = s.vma + offset;
+                break;
+            }
+            offset -= s.size;
+        }
+        auto it = std::lower_bound(starts.begin(), starts.end(), target);
+        if (it == starts.end()) break;
+        if (*it == starts.front()) continue;
+        if (bounds.empty() || *it > bounds.back()) bounds.push_back(*it);
+    }
+    return bounds;
+}
+
+int Disassembler::runSharded(const Options& opts, const std::vector<uint64_t>& bounds, OutputSink& sink, const Progress& progress) {
+    std::vector<BinaryInfo::Section> code = BinaryInfo::load(opts.file).codeSections();
+
+    std::vector<Shard> shards(bounds.size() + 1);
+    for (size_t i = 0; i < shards.size(); ++i) {
+        Shard& sh = shards[i];
+        if (i > 0) {
+            sh.hasStart = true;
+            sh.start = bounds[i - 1];
+            sh.continuesSection = true;
+            for (const auto& s : code) {
+                if (s.vma == sh.start) sh.continuesSection = false;
+            }
+        }
+        if (i < bounds.size()) {
+            sh.hasStop = true;
+            sh.stop = bounds[i];
+        }
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::atomic<size_t> next{1}; // Shard 0 is run by the merging thread / 샤드 0은 병합 스레드가 실행
+    std::atomic<long long> produced{0};
+    const std::vector<std::string> base = baseArgs(opts);
+    auto argsFor = [&](const Shard& sh) {
+        std::vector<std::string> args = base;
+        if (sh.hasStart) args.push_back("--start-address=" + hex(sh.start));
+        if (sh.hasStop) args.push_back("--stop-address=" + hex(sh.stop));
+        args.push_back(opts.file);
+        return args;
+    };
+
+    auto worker = [&]() {
+        std::vector<char> buffer(kChunkSize);
+        for (size_t i = next++; i < shards.size(); i = next++) {
+            Shard& sh = shards[i];
+            if (cancelled(opts)) {
+                // Left without output; the merge skips it / 출력 없이 두며 병합에서 건너뜀
+                std::lock_guard<std::mutex> lock(mtx);
+                sh.done = true;
+                cv.notify_all();
+                continue;
+            }
+            FILE* tmp = tmpfile();
+            pid_t pid;
+            int in = tmp ? spawn(argsFor(sh), opts.errorFd, pid) : -1;
+            bool failed = in < 0;
+            int code = 0;
+            if (in >= 0) {
+                ssize_t n;
+                while ((n = ::read(in, buffer.data(), buffer.size())) > 0 || (n < 0 && errno == EINTR)) {
+                    if (n < 0) continue;
+                    if (cancelled(opts)) {
+                        kill(pid, SIGTERM);
+                        break;
+                    }
+                    if (fwrite(buffer.data(), 1, static_cast<size_t>(n), tmp) != static_cast<size_t>(n)) failed = true;
+                    produced += n;
+                }
+                ::close(in);
+                code = reap(pid);
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            sh.out = tmp;
+            sh.failed = failed;
+            sh.code = code;
+            sh.done = true;
+            cv.notify_all();
+        }
+    };
+
+    // This thread runs shard 0 in place of one worker, then hands the slot back
+    // 이 스레드가 작업자 하나 대신 샤드 0을 실행한 뒤 자리를 돌려줌
+    int workers = std::min<int>(clampJobs(opts.jobs), static_cast<int>(shards.size()));
+    std::vector<std::thread> pool;
+    for (int i = 1; i < workers; ++i) pool.emplace_back(worker);
+
+    // The first shard error wins; a shard that never ran outranks an exit code
+    // 첫 샤드 오류를 반환하며, 실행되지 못한 샤드가 종료 코드보다 우선
+    int result = 0;
+    std::vector<char> buffer(kChunkSize);
+    {
+        // Shard 0 leads the listing, so it streams straight into the sink / 샤드 0은 목록의 앞이므로 싱크로 바로 스트리밍
+        pid_t pid;
+        int in = spawn(argsFor(shards[0]), opts.errorFd, pid);
+        if (in < 0) {
+            result = kNotStarted;
+        } else {
+            ssize_t n;
+            while ((n = ::read(in, buffer.data(), buffer.size())) > 0 || (n < 0 && errno == EINTR)) {
+                if (n < 0) continue;
+                if (cancelled(opts)) {
+                    kill(pid, SIGTERM);
+                    break;
+                }
+                sink.write(buffer.data(), static_cast<size_t>(n));
+                produced += n;
+                if (progress) progress(produced.load());
+            }
+            ::close(in);
+            result = reap(pid);
+        }
+    }
+    pool.emplace_back(worker);
+
+    // Merge the rest in address order while later shards are still running
+    // 뒤의 샤드가 실행 중인 동안 나머지를 주소 순서대로 병합
+    for (size_t i = 1; i < shards.size(); ++i) {
+        Shard& sh = shards[i];
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            while (!sh.done) {
+                cv.wait_for(lock, std::chrono::milliseconds(100));
+                if (progress) progress(produced.load());
+            }
+        }
+        if (cancelled(opts)) {
+            if (sh.out) fclose(sh.out);
+            continue;
+        }
+        if (sh.failed || !sh.out) {
+            result = kNotStarted;
+            if (sh.out) fclose(sh.out);
+            continue;
+        }
+        if (result == 0) result = sh.code;
+
+        rewind(sh.out);
+        // Drop the repeated "\n<file>: file format ...\n\n" preamble, and the
+        // "\nDisassembly of section X:" header when the previous shard already opened X
+        // 반복되는 파일 형식 머리말과 이미 열린 섹션 머리글을 제거
+        char* line = nullptr;
+        size_t cap = 0;
+        for (int l = 0; l < 3 && getline(&line, &cap, sh.out) >= 0; ++l) {}
+        if (sh.continuesSection) {
+            long mark = ftell(sh.out);
+            bool blank = getline(&line, &cap, sh.out) >= 0 && line[0] == '\n';
+            bool header = blank && getline(&line, &cap, sh.out) >= 0 &&
+                          std::strncmp(line, "Disassembly of section ", 23) == 0;
+            if (!header) fseek(sh.out, mark, SEEK_SET);
+        }
+        free(line);
+        size_t n;
+        while ((n = fread(buffer.data(), 1, buffer.size(), sh.out)) > 0) {
+            sink.write(buffer.data(), n);
+        }
+        fclose(sh.out);
+        if (progress) progress(produced.load());
+    }
+
+    for (std::thread& t : pool) t.join();
+    sink.flush();
+    return cancelled(opts) ? 0 : result;
+}
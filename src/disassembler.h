@@ -0,0 +1,73 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Disassembler Header - objdump driver with parallel address-range sharding
+ */
+#ifndef DISASSEMBLER_H
+#define DISASSEMBLER_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <sys/types.h>
+#include "stream_sink.h"
+
+class Disassembler {
+public:
+    static constexpr int kNotStarted = -1; // run() result when objdump could not be started / objdump 시작 실패 시 결과
+
+    struct Options {
+        std::string file;
+        bool intel = false;
+        int jobs = 1; // Worker processes (-j N) / 작업 프로세스 수
+        int errorFd = -1; // objdump stderr goes here; -1 inherits ours / objdump stderr 대상, -1이면 상속
+        // Once set, objdump is killed and the listing ends early / 설정되면 objdump를 종료하고 목록이 일찍 끝남
+        const std::atomic<bool>* cancel = nullptr;
+    };
+
+    // Called with the total number of objdump bytes produced so far / 지금까지 생성된 objdump 바이트 수
+    using Progress = std::function<void(long long)>;
+
+    /**
+     * Runs objdump on the file and streams the listing into the sink.
+     * With jobs > 1 (capped at the core count) the executable sections are split at symbol
+     * boundaries and disassembled by parallel workers; the merged listing is byte-identical
+     * to the serial one. Returns objdump's exit code: 0 on success, 128 + signal if it
+     * was killed, kNotStarted if it could not be started. Only a clean 0 means the
+     * listing is complete; a cancelled run returns 0 with a truncated listing.
+     * 파일에 objdump를 실행하여 싱크로 스트리밍합니다. jobs > 1이면(코어 수가 상한) 심볼 경계에서
+     * 분할하여 병렬로 처리하며, 병합 결과는 직렬 출력과 바이트 단위로 동일합니다.
+     * objdump의 종료 코드를 반환합니다(성공 0, 시그널 종료 시 128 + 시그널, 시작 실패 시 kNotStarted).
+     * 0일 때만 목록이 완전하며, 취소된 실행은 잘린 목록과 함께 0을 반환합니다.
+     */
+    static int run(const Options& opts, OutputSink& sink, const Progress& progress = nullptr);
+
+    /**
+     * Chooses interior shard boundaries from the native section and symbol tables.
+     * Returns an empty list when the layout cannot be sharded safely
+     * (no function symbols, relocatable, overlapping sections).
+     * 샤드 경계를 선택합니다. 안전하게 분할할 수 없으면 빈 목록을 반환합니다.
+     */
+    static std::vector<uint64_t> planShards(const std::string& file, int shards);
+
+    /**
+     * Same listing as run(), written straight to fd for callers that never read it.
+     * splice(2) moves the pipe into the file without a pass through user space, with
+     * large read/write calls as the fallback. Returns the same codes as run(); written
+     * is false after a write error.
+     * run()과 같은 목록을 fd에 직접 기록합니다. splice(2)로 사용자 공간을 거치지 않고 파이프를
+     * 파일로 옮기며, 불가하면 큰 read/write로 대체합니다. run()과 같은 코드를 반환하며, 쓰기 오류 시
+     * written은 false입니다.
+     */
+    static int runToFile(const Options& opts, int fd, bool& written, const Progress& progress = nullptr);
+
+private:
+    static std::vector<std::string> baseArgs(const Options& opts);
+    // Starts objdump with stdout on a pipe; returns the read end, or -1 / 파이프 읽기 끝 반환, 실패 시 -1
+    static int spawn(const std::vector<std::string>& args, int errorFd, pid_t& pid);
+    static int runSerial(const Options& opts, OutputSink& sink, const Progress& progress);
+    static int runSharded(const Options& opts, const std::vector<uint64_t>& bounds, OutputSink& sink, const Progress& progress);
+};
+
+#endif
@@ -2,79 +2,218 @@
 #define I18N_H
 
 #include <string>
-#include <map>
+#include <string_view>
+#include <array>
 #include <vector>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
 
 /**
  * @brief Internationalization System / 국제화 시스템
  * Rheehose (Rhee Creative) 2008-2026
+ *
+ * Messages are an enum indexing constexpr string tables, so a lookup is one array load
+ * with no allocation and an unknown key does not compile. Every view is NUL-terminated,
+ * so data() may be handed to C and Qt APIs directly.
+ * 메시지는 constexpr 문자열 표를 가리키는 열거형이므로 조회는 배열 접근 한 번이며 할당이 없고,
+ * 없는 키는 컴파일되지 않습니다. 모든 뷰는 NUL로 끝나므로 data()를 C/Qt API에 바로 넘길 수 있습니다.
  */
 
 enum class Language {
     KO,
-    EN
+    EN,
+    Custom // Loaded from a file at startup / 시작 시 파일에서 로드
 };
 
+enum class Msg : uint16_t {
+    // Shared & GUI Strings / 공유 및 GUI 문자열
+    AppTitle,
+    OpenBinary,
+    SaveAsm,
+    SaveAs,
+    IntelSyntax,
+    LangToggle,
+    ReadOnly,
+    Ready,
+    Disassembling,
+    Finished,
+    SavedTo,
+    ReadonlyWarn,
+    ExtractStrings,
+    PythonRev,
+    StringsFinished,
+    ThemeToggle,
+    LightMode,
+    DarkMode,
+    InterpretedRev,
+    // CLI specific / CLI 전용
+    CliUsage,
+    CliLangCmd,
+    UnknownOption,
+    FileNotFound,
+    ObjdumpFailed,
+    OutputFileFailed,
+    Analyzing,
+    Architecture,
+    Visualizing,
+    GoTo,
+    GoToPrompt,
+    GoToNotFound,
+    ObjdumpStatus,
+    Queued,
+    Count
+};
+
+// Message table; the class below only selects a column / 메시지 표, 아래 클래스는 열만 선택
+namespace i18n_table {
+constexpr size_t kCount = static_cast<size_t>(Msg::Count);
+using Table = std::array<std::string_view, kCount>;
+
+struct Row {
+    Msg msg;
+    std::string_view key; // Name used by language files / 언어 파일에서 쓰는 이름
+    std::string_view ko;
+    std::string_view en;
+};
+
+inline constexpr Row kMessages[] = {
+    {Msg::AppTitle, "app_title", "thedecoder - 상급 바이너리 분석기", "thedecoder - Advanced Binary Analyzer"},
+    {Msg::OpenBinary, "open_binary", "바이너리 열기", "Open Binary"},
+    {Msg::SaveAsm, "save_asm", "ASM 저장", "Save ASM"},
+    {Msg::SaveAs, "save_as", "다른 이름으로 저장", "Save As"},
+    {Msg::IntelSyntax, "intel_syntax", "Intel 문법", "Intel Syntax"},
+    {Msg::LangToggle, "lang_toggle", "Language: KR", "Language: EN"},
+    {Msg::ReadOnly, "read_only", "읽기 전용", "Read Only"},
+    {Msg::Ready, "ready", "준비됨", "Ready"},
+    {Msg::Disassembling, "disassembling", "역어셈블 중...", "Disassembling..."},
+    {Msg::Finished, "finished", "완료됨", "Finished"},
+    {Msg::SavedTo, "saved_to", "저장 완료: ", "Saved to: "},
+    {Msg::ReadonlyWarn, "readonly_warn", "상단에서 '읽기 전용' 체크를 해제한 후 편집하십시오.", "Please uncheck 'Read Only' at the top to edit."},
+    {Msg::ExtractStrings, "extract_strings", "문자열 추출", "Extract Strings"},
+    {Msg::PythonRev, "python_rev", "파이썬 분석", "Python Rev"},
+    {Msg::StringsFinished, "strings_finished", "문자열 추출 완료", "Strings extraction finished"},
+    {Msg::ThemeToggle, "theme_toggle", "테마 전환", "Toggle Theme"},
+    {Msg::LightMode, "light_mode", "라이트 모드", "Light Mode"},
+    {Msg::DarkMode, "dark_mode", "다크 모드", "Dark Mode"},
+    {Msg::InterpretedRev, "interpreted_rev", "인터프리터 분석", "Interpreted Rev"},
+    {Msg::CliUsage, "cli_usage", "사용법: thedecoder <바이너리> [옵션]", "Usage: thedecoder <binary> [options]"},
+    {Msg::CliLangCmd, "cli_lang_cmd", "/lang: 언어 전환 (현재: 한국어)", "/lang: Toggle language (Current: English)"},
+    {Msg::UnknownOption, "unknown_option", "알 수 없는 옵션", "Unknown option"},
+    {Msg::FileNotFound, "error_file_not_found", "파일을 찾을 수 없습니다", "Error: File not found"},
+    {Msg::ObjdumpFailed, "error_objdump_failed", "objdump 실행 실패. binutils 설치 여부를 확인하십시오.", "Failed to run objdump. Ensure binutils is installed."},
+    {Msg::OutputFileFailed, "error_output_file_failed", "출력 파일을 열 수 없습니다", "Failed to open output file"},
+    {Msg::Analyzing, "analyzing", "분석 중", "Analyzing"},
+    {Msg::Architecture, "architecture", "아키텍처", "Architecture"},
+    {Msg::Visualizing, "visualizing", "시각화 중", "Visualizing"},
+    {Msg::GoTo, "goto", "이동", "Go To"},
+    {Msg::GoToPrompt, "goto_prompt", "주소(16진수) 또는 심볼", "Address (hex) or symbol"},
+    {Msg::GoToNotFound, "goto_not_found", "찾을 수 없음", "Not found"},
+    {Msg::ObjdumpStatus, "note_objdump_status", "objdump가 다음 상태로 종료되었습니다", "objdump exited with status"},
+    {Msg::Queued, "queued", "대기 중", "Queued"},
+};
+
+constexpr bool rowsInOrder() {
+    for (size_t i = 0; i < kCount; ++i) {
+        if (static_cast<size_t>(kMessages[i].msg) != i || kMessages[i].key.empty()) return false;
+    }
+    return true;
+}
+static_assert(sizeof(kMessages) / sizeof(kMessages[0]) == kCount && rowsInOrder(),
+              "kMessages needs exactly one row per Msg, in enum order / Msg마다 순서대로 한 행 필요");
+
+constexpr Table column(bool english) {
+    Table t{};
+    for (size_t i = 0; i < kCount; ++i) t[i] = english ? kMessages[i].en : kMessages[i].ko;
+    return t;
+}
+inline constexpr Table kKo = column(false);
+inline constexpr Table kEn = column(true);
+
+} // namespace i18n_table
+
 class I18n {
 public:
+    static constexpr size_t kCount = i18n_table::kCount;
+    using Table = i18n_table::Table;
+
     static I18n& instance() {
         static I18n inst;
         return inst;
     }
 
-    void setLanguage(Language lang) { m_currentLang = lang; }
+    void setLanguage(Language lang) {
+        if (lang == Language::Custom && !m_hasCustom) return;
+        m_currentLang = lang;
+        m_active = lang == Language::KO ? &i18n_table::kKo : lang == Language::EN ? &i18n_table::kEn : &m_custom;
+    }
     Language currentLanguage() const { return m_currentLang; }
 
-    std::string get(const std::string& key) {
-        if (m_dict.find(key) == m_dict.end()) return key;
-        return (m_currentLang == Language::KO) ? m_dict[key].ko : m_dict[key].en;
-    }
+    std::string_view get(Msg msg) const { return (*m_active)[static_cast<size_t>(msg)]; }
 
+    // KO -> EN -> loaded language (if any) -> KO / 한국어 -> 영어 -> 로드된 언어 -> 한국어
     void toggleLanguage() {
-        m_currentLang = (m_currentLang == Language::KO) ? Language::EN : Language::KO;
+        if (m_currentLang == Language::KO) setLanguage(Language::EN);
+        else if (m_currentLang == Language::EN && m_hasCustom) setLanguage(Language::Custom);
+        else setLanguage(Language::KO);
     }
 
+    /**
+     * Loads "key = text" lines (as named in i18n_table::kMessages) into the Custom language; "#" starts
+     * a comment, "\n" is a newline, and missing keys fall back to English.
+     * "키 = 텍스트" 행을 Custom 언어로 로드합니다. "#"은 주석, "\n"은 개행이며 없는 키는 영어로 대체됩니다.
+     */
+    bool loadLanguage(const std::string& path) {
+        std::ifstream in(path);
+        if (!in.is_open()) return false;
+        std::vector<std::string> texts(kCount);
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t eq = line.find('=');
+            if (line.empty() || line[0] == '#' || eq == std::string::npos) continue;
+            std::string_view key = trim(std::string_view(line).substr(0, eq));
+            for (const i18n_table::Row& row : i18n_table::kMessages) {
+                if (row.key != key) continue;
+                texts[static_cast<size_t>(row.msg)] = unescape(trim(std::string_view(line).substr(eq + 1)));
+                break;
+            }
+        }
+        m_customText = std::move(texts);
+        for (size_t i = 0; i < kCount; ++i) m_custom[i] = m_customText[i].empty() ? i18n_table::kEn[i] : m_customText[i];
+        m_customPath = path;
+        m_hasCustom = true;
+        if (m_currentLang == Language::Custom) setLanguage(Language::Custom);
+        return true;
+    }
+    const std::string& customLanguagePath() const { return m_customPath; }
+
 private:
-    struct Entry {
-        std::string ko;
-        std::string en;
-    };
-
-    I18n() : m_currentLang(Language::KO) {
-        // Shared & GUI Strings / 공유 및 GUI 문자열
-        m_dict["app_title"] = {"thedecoder - 상급 바이너리 분석기", "thedecoder - Advanced Binary Analyzer"};
-        m_dict["open_binary"] = {"바이너리 열기", "Open Binary"};
-        m_dict["save_asm"] = {"ASM 저장", "Save ASM"};
-        m_dict["save_as"] = {"다른 이름으로 저장", "Save As"};
-        m_dict["intel_syntax"] = {"Intel 문법", "Intel Syntax"};
-        m_dict["lang_toggle"] = {"Language: KR", "Language: EN"};
-        m_dict["read_only"] = {"읽기 전용", "Read Only"};
-        m_dict["ready"] = {"준비됨", "Ready"};
-        m_dict["disassembling"] = {"역어셈블 중...", "Disassembling..."};
-        m_dict["finished"] = {"완료됨", "Finished"};
-        m_dict["saved_to"] = {"저장 완료: ", "Saved to: "};
-        m_dict["readonly_warn"] = {"상단에서 '읽기 전용' 체크를 해제한 후 편집하십시오.", "Please uncheck 'Read Only' at the top to edit."};
-        m_dict["extract_strings"] = {"문자열 추출", "Extract Strings"};
-        m_dict["python_rev"] = {"파이썬 분석", "Python Rev"};
-        m_dict["strings_finished"] = {"문자열 추출 완료", "Strings extraction finished"};
-        m_dict["theme_toggle"] = {"테마 전환", "Toggle Theme"};
-        m_dict["light_mode"] = {"라이트 모드", "Light Mode"};
-        m_dict["dark_mode"] = {"다크 모드", "Dark Mode"};
-        m_dict["interpreted_rev"] = {"인터프리터 분석", "Interpreted Rev"};
-        
-        // CLI specific / CLI 전용
-        m_dict["cli_usage"] = {"사용법: thedecoder <바이너리> [옵션]", "Usage: thedecoder <binary> [options]"};
-        m_dict["cli_lang_cmd"] = {"/lang: 언어 전환 (현재: 한국어)", "/lang: Toggle language (Current: English)"};
-        m_dict["unknown_option"] = {"알 수 없는 옵션", "Unknown option"};
-        m_dict["error_file_not_found"] = {"파일을 찾을 수 없습니다", "Error: File not found"};
-        m_dict["error_objdump_failed"] = {"objdump 실행 실패. binutils 설치 여부를 확인하십시오.", "Failed to run objdump. Ensure binutils is installed."};
-        m_dict["error_output_file_failed"] = {"출력 파일을 열 수 없습니다", "Failed to open output file"};
-        m_dict["analyzing"] = {"분석 중", "Analyzing"};
-        m_dict["note_objdump_status"] = {"참고: objdump가 다음 상태로 종료되었습니다", "Note: objdump finished with status"};
+    static std::string_view trim(std::string_view s) {
+        while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+        while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+        return s;
     }
+    static std::string unescape(std::string_view s) {
+        std::string out;
+        for (size_t i = 0; i < s.size(); ++i) {
+            if (s[i] == '\\' && i + 1 < s.size() && s[i + 1] == 'n') {
+                out += '\n';
+                ++i;
+            } else {
+                out += s[i];
+            }
+        }
+        return out;
+    }
+
+    I18n() = default;
 
-    Language m_currentLang;
-    std::map<std::string, Entry> m_dict;
+    Language m_currentLang = Language::KO;
+    const Table* m_active = &i18n_table::kKo;
+    Table m_custom{};
+    std::vector<std::string> m_customText; // Owns the Custom views / Custom 뷰의 저장소
+    std::string m_customPath;
+    bool m_hasCustom = false;
 };
 
 #endif // I18N_H
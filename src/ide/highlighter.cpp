@@ -3,93 +3,77 @@
  * Asm Syntax Highlighter Implementation
  */
 #include "highlighter.h"
-#include <QRegularExpression>
 #include <QTextDocument>
 
+namespace {
+using Token = AsmLexer::Token;
+
+void buildPalette(QTextCharFormat *p, bool dark) {
+    // Palette Colors (Monster Grade) / 팔레트 색상 (몬스터 등급)
+    QColor addrCol    = dark ? QColor("#f28b82") : QColor("#c5221f"); // Addresses
+    QColor opCol      = dark ? QColor("#8ab4f8") : QColor("#1a73e8"); // Mnemonics
+    QColor regCol     = dark ? QColor("#aecbfa") : QColor("#185abc"); // Registers
+    QColor hexCol     = dark ? QColor("#fdd663") : QColor("#e37400"); // Hex bytes / Constant
+    QColor strCol     = dark ? QColor("#81c995") : QColor("#137333"); // Strings (Vivid Green)
+    QColor commentCol = dark ? QColor("#9aa0a6") : QColor("#5f6368"); // Comments
+
+    auto set = [p](Token t, const QColor &color, bool bold) {
+        QTextCharFormat &f = p[static_cast<int>(t)];
+        f.setForeground(color);
+        if (bold) f.setFontWeight(QFont::Bold);
+    };
+    set(Token::Address, addrCol, true);
+    set(Token::Bytes, hexCol, false);
+    set(Token::Mnemonic, opCol, true);
+    set(Token::Register, regCol, true);
+    set(Token::Keyword, opCol, true);
+    set(Token::Immediate, hexCol, false);
+    set(Token::Symbol, opCol, false);
+    set(Token::String, strCol, false);
+    set(Token::Comment, commentCol, false);
+    p[static_cast<int>(Token::Comment)].setFontItalic(true);
+}
+}
+
 AsmHighlighter::AsmHighlighter(QTextDocument *parent)
     : QSyntaxHighlighter(parent)
 {
-    setupRules(true); // Default to dark / 기본값 다크
+}
+
+const AsmHighlighter::Palette &AsmHighlighter::palette(bool dark) {
+    // Built on first use and shared by every highlighter / 처음 사용할 때 만들어 모든 하이라이터가 공유
+    static const struct Palettes {
+        Palette dark, light;
+        Palettes() {
+            buildPalette(dark, true);
+            buildPalette(light, false);
+        }
+    } palettes;
+    return dark ? palettes.dark : palettes.light;
 }
 
 void AsmHighlighter::setDarkMode(bool dark) {
-    setupRules(dark);
+    m_dark = dark;
     rehighlight();
 }
 
-void AsmHighlighter::setupRules(bool dark) {
-    m_rules.clear();
+QVector<QTextLayout::FormatRange> AsmHighlighter::formatLine(const QString &text) const {
+    // Latin-1 keeps one byte per QChar, so span offsets are character offsets
+    // Latin-1은 QChar마다 한 바이트이므로 스팬 오프셋이 곧 문자 오프셋
+    QByteArray bytes = text.toLatin1();
+    AsmLexer::Span spans[AsmLexer::kMaxSpans];
+    size_t n = AsmLexer::lex(std::string_view(bytes.constData(), static_cast<size_t>(bytes.size())), spans);
 
-    // Palette Colors (Monster Grade) / 팔레트 색상 (몬스터 등급)
-    QString addrCol    = dark ? "#f28b82" : "#c5221f"; // Addresses
-    QString opCol      = dark ? "#8ab4f8" : "#1a73e8"; // Mnemonics
-    QString regCol     = dark ? "#aecbfa" : "#185abc"; // Registers
-    QString hexCol     = dark ? "#fdd663" : "#e37400"; // Hex bytes / Constant
-    QString strCol     = dark ? "#81c995" : "#137333"; // Strings (Vivid Green)
-    QString commentCol = dark ? "#9aa0a6" : "#5f6368"; // Comments
-
-    // Comments / 주석
-    {
-        Rule r;
-        r.re = new QRegularExpression(";.*");
-        r.fmt.setForeground(QColor(commentCol));
-        r.fmt.setFontItalic(true);
-        m_rules.append(r);
-    }
-
-    // Strings / 문자열
-    {
-        Rule r;
-        r.re = new QRegularExpression("\".*?\"|'.*?'");
-        r.fmt.setForeground(QColor(strCol));
-        m_rules.append(r);
-    }
-
-    // addresses / 주소
-    {
-        Rule r;
-        r.re = new QRegularExpression("\\b[0-9a-fA-F]{4,16}\\b");
-        r.fmt.setForeground(QColor(addrCol));
-        r.fmt.setFontWeight(QFont::Bold);
-        m_rules.append(r);
-    }
-
-    // opcodes / mnemonics / 옵코드/니모닉
-    {
-        Rule r;
-        r.re = new QRegularExpression("\\b(mov|movzx|movsx|add|sub|jmp|call|ret|push|pop|cmp|jne|je|jz|jnz|lea|xor|and|or|inc|dec|test|nop|syscall|int|leave|nop|short|long|ptr|byte|word|dword|qword|offset|setz|setnz|clc|stc|std|cld|loop|rep|movsb|movsw|movsd|movsq|scasb|scasw|scasd|scasq|extras|xchg|xadd|cmpxchg|cmova|cmovae|cmovb|cmovbe|cmovc|cmove|cmovg|cmovge|cmovl|cmovle|cmovna|cmovnae|cmovnb|cmovnbe|cmovnc|cmovne|cmovng|cmovnge|cmovnl|cmovnle|cmovno|cmovnp|cmovns|cmovnz|cmovo|cmovp|cmovpe|cmovpo|cmovs|cmovz)\\b",
-                                      QRegularExpression::CaseInsensitiveOption);
-        r.fmt.setForeground(QColor(opCol));
-        r.fmt.setFontWeight(QFont::Bold);
-        m_rules.append(r);
-    }
-
-    // Registers / 레지스터
-    {
-        Rule r;
-        r.re = new QRegularExpression("\\b(rax|rbx|rcx|rdx|rsi|rdi|rbp|rsp|r8|r9|r10|r11|r12|r13|r14|r15|eax|ebx|ecx|edx|esi|edi|ebp|esp|ax|bx|cx|dx|si|di|bp|sp|al|bl|cl|dl|ah|bh|ch|dh|rip|eip|ip|cs|ds|es|fs|gs|ss|cr0|cr2|cr3|cr4|dr0|dr1|dr2|dr3|dr6|dr7|st0|st1|st2|st3|st4|st5|st6|st7|mm0|mm1|mm2|mm3|mm4|mm5|mm6|mm7|xmm0|xmm1|xmm2|xmm3|xmm4|xmm5|xmm6|xmm7|xmm8|xmm9|xmm10|xmm11|xmm12|xmm13|xmm14|xmm15|ymm0|ymm1|ymm2|ymm3|ymm4|ymm5|ymm6|ymm7|ymm8|ymm9|ymm10|ymm11|ymm12|ymm13|ymm14|ymm15|zmm0|zmm1|zmm2|zmm3|zmm4|zmm5|zmm6|zmm7|zmm8|zmm9|zmm10|zmm11|zmm12|zmm13|zmm14|zmm15)\\b",
-                                      QRegularExpression::CaseInsensitiveOption);
-        r.fmt.setForeground(QColor(regCol));
-        r.fmt.setFontWeight(QFont::Bold);
-        m_rules.append(r);
-    }
-
-    // hex bytes / 16진수 바이트
-    {
-        Rule r;
-        r.re = new QRegularExpression("\\b[0-9a-fA-F]{2}(?: [0-9a-fA-F]{2})*\\b");
-        r.fmt.setForeground(QColor(hexCol));
-        m_rules.append(r);
+    const Palette &p = palette(m_dark);
+    QVector<QTextLayout::FormatRange> out;
+    out.reserve(static_cast<int>(n));
+    for (size_t i = 0; i < n; ++i) {
+        out.append({static_cast<int>(spans[i].off), static_cast<int>(spans[i].len), p[static_cast<int>(spans[i].token)]});
     }
+    return out;
 }
 
 void AsmHighlighter::highlightBlock(const QString &text)
 {
-    for (const Rule &r : qAsConst(m_rules)) {
-        QRegularExpressionMatchIterator it = r.re->globalMatch(text);
-        while (it.hasNext()) {
-            QRegularExpressionMatch m = it.next();
-            setFormat(m.capturedStart(), m.capturedLength(), r.fmt);
-        }
-    }
+    for (const QTextLayout::FormatRange &r : formatLine(text)) setFormat(r.start, r.length, r.format);
 }
@@ -3,27 +3,34 @@
  * Asm Syntax Highlighter Header
  */
 #ifndef HIGHLIGHTER_H
-#define ASMHIGHLIGHTER_H
+#define HIGHLIGHTER_H
 
 #include <QSyntaxHighlighter>
 #include <QTextCharFormat>
+#include <QTextLayout>
+#include "../asm_lexer.h"
 
-class QRegularExpression;
-
+/**
+ * @brief Colours assembly through AsmLexer, one pass per line / AsmLexer로 행마다 한 번 순회하여 어셈블리 강조
+ * Word tables are compiled in and the two palettes are built once, so every tab shares them.
+ * 단어 표는 컴파일 시 포함되고 두 팔레트는 한 번만 만들어져 모든 탭이 공유합니다.
+ */
 class AsmHighlighter : public QSyntaxHighlighter
 {
     Q_OBJECT
 public:
     explicit AsmHighlighter(QTextDocument *parent = nullptr);
     void setDarkMode(bool dark);
+    // Formats for one line, for views that draw text themselves / 텍스트를 직접 그리는 뷰를 위한 한 행의 서식
+    QVector<QTextLayout::FormatRange> formatLine(const QString &text) const;
 
 protected:
     void highlightBlock(const QString &text) override;
 
 private:
-    void setupRules(bool dark);
-    struct Rule { QRegularExpression *re; QTextCharFormat fmt; };
-    QVector<Rule> m_rules;
+    using Palette = QTextCharFormat[static_cast<int>(AsmLexer::Token::Count)];
+    static const Palette &palette(bool dark);
+    bool m_dark = true; // Default to dark / 기본값 다크
 };
 
-#endif // ASMHIGHLIGHTER_H
+#endif // HIGHLIGHTER_H
@@ -0,0 +1,187 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Job Manager Implementation - Session workers and queue scheduling
+ */
+#include "job_manager.h"
+#include <QFileInfo>
+#include <QThread>
+#include <cstdio>
+#include "../binary_info.h"
+#include "../disassembler.h"
+
+DisassemblySession::DisassemblySession(const QString &file, const QString &arch, int jobs, ResultCache &cache,
+                                       ListingView *view, QObject *parent)
+    : QObject(parent), m_file(file), m_arch(arch), m_jobs(jobs), m_cache(cache), m_view(view), m_feed(view->feed()),
+      m_fileSize(QFileInfo(file).size()) {}
+
+DisassemblySession::~DisassemblySession() {
+    if (!m_worker) return;
+    // Nothing reads the output any more, so the feed drops it / 더 이상 읽는 곳이 없으므로 피드는 출력을 버림
+    m_cancel = true;
+    m_feed->abandon();
+    m_worker->wait();
+    delete m_worker;
+}
+
+QString DisassemblySession::name() const {
+    return QFileInfo(m_file).fileName();
+}
+
+QString DisassemblySession::mode() const {
+    QString mode = m_arch;
+    if (m_cacheHit) mode += ", cached";
+    else if (m_jobs > 1) mode += ", -j" + QString::number(m_jobs);
+    return mode;
+}
+
+void DisassemblySession::start() {
+    m_state = State::Running;
+    m_progress.reset(BinaryInfo::load(m_file.toStdString()));
+
+    Disassembler::Options opts;
+    opts.file = m_file.toStdString();
+    opts.intel = m_arch == "x86-64" || m_arch == "i386";
+    opts.jobs = m_jobs;
+    opts.cancel = &m_cancel;
+    std::string arch = m_arch.toStdString();
+
+    // Hashing reads the whole input, so it happens on the worker too / 해시는 입력 전체를 읽으므로 작업 스레드에서 수행
+    m_worker = QThread::create([this, opts, arch]() mutable {
+        std::shared_ptr<ListingFeed> feed = m_feed;
+        TeeSink tee;
+        tee.add(feed.get());
+        tee.add(&m_progress);
+
+        // Same keys as the CLI, so either side can serve the other's results / CLI와 같은 키로 서로의 결과 재사용
+        std::string listingKey;
+        uint64_t content;
+        if (m_cache.isEnabled() && ResultCache::hashFile(opts.file, content)) {
+            std::string options = ResultCache::listingOptions(opts.intel, arch);
+            listingKey = ResultCache::key(content, "asm", options);
+            m_graphKey = ResultCache::key(content, "mermaid", options);
+        }
+        std::string cached = listingKey.empty() ? std::string() : m_cache.lookup(listingKey);
+        if (!cached.empty()) {
+            // Stream the cached listing without starting objdump; an entry evicted before it
+            // could be opened falls back to objdump, as in the CLI
+            // objdump 없이 캐시된 목록을 스트리밍하며, 열기 전에 제거된 항목은 CLI처럼 objdump로 대체
+            long long streamed = 0;
+            if (ResultCache::streamListing(cached, opts.file, tee, [&streamed](long long n) { streamed = n; })) {
+                m_cacheHit = true;
+                feed->flush();
+                return;
+            }
+            if (streamed > 0) {
+                // Part of the listing is already shown and cannot be taken back / 목록 일부가 이미 표시되어 되돌릴 수 없음
+                m_failed = true;
+                feed->flush();
+                return;
+            }
+        }
+
+        std::unique_ptr<ResultCache::Writer> store;
+        if (!listingKey.empty()) {
+            store = std::make_unique<ResultCache::Writer>(m_cache, listingKey);
+            tee.add(store.get());
+        }
+        // stderr is kept apart and shown after the listing, never cached / stderr는 따로 모아 목록 뒤에 표시하며 캐시하지 않음
+        FILE *err = tmpfile();
+        opts.errorFd = err ? fileno(err) : -1;
+        long long produced = 0;
+        // A stop returns 0 but is incomplete; a nonzero exit may have cut the listing short
+        // 중지는 0을 반환하지만 불완전하며, 0이 아닌 종료는 목록을 중간에 끊었을 수 있음
+        int code = Disassembler::run(opts, tee, [&produced](long long n) { produced = n; });
+        if (code != 0) {
+            m_failed = true;
+        } else if (store && produced > 0 && !m_cancel) {
+            store->commit();
+        }
+        if (err) {
+            std::string text;
+            char buf[4096];
+            rewind(err);
+            for (size_t n; (n = fread(buf, 1, sizeof(buf), err)) > 0;) text.append(buf, n);
+            fclose(err);
+            if (!text.empty()) {
+                text = "\n--- stderr ---\n" + text + "\n";
+                feed->write(text.data(), text.size());
+            }
+        }
+        feed->flush();
+    });
+    connect(m_worker, &QThread::finished, this, [this]() {
+        m_state = State::Finished;
+        m_progress.finish();
+        emit finished(this);
+    });
+    m_worker->start();
+}
+
+int DisassemblySession::percent() const {
+    if (m_state == State::Finished) return 100;
+    // Code addresses reached out of the executable size; the listing-size guess is only a fallback
+    // 실행 크기 대비 도달한 코드 주소 기준, 목록 크기 추정은 대체 수단
+    CodeProgress::Snapshot s = m_progress.snapshot();
+    double fraction = s.known() ? s.fraction()
+                                : static_cast<double>(s.listingBytes) / (m_fileSize * 4.0 + 1.0);
+    return qMin(99, static_cast<int>(fraction * 100));
+}
+
+QString DisassemblySession::rateText() const {
+    CodeProgress::Snapshot s = m_progress.snapshot();
+    double eta = s.eta();
+    if (m_state != State::Running || !s.known() || eta < 0) return QString();
+    return QString("%1 MB/s  ETA %2s").arg(s.codeRate() / (1024.0 * 1024.0), 0, 'f', 1).arg(eta, 0, 'f', 0);
+}
+
+JobManager::JobManager(int maxConcurrent, QObject *parent)
+    : QObject(parent), m_maxConcurrent(qMax(1, maxConcurrent)) {}
+
+void JobManager::setMaxConcurrent(int n) {
+    m_maxConcurrent = qMax(1, n);
+    pump();
+}
+
+void JobManager::submit(DisassemblySession *session) {
+    session->setParent(this);
+    m_sessions.append(session);
+    connect(session, &DisassemblySession::finished, this, [this](DisassemblySession *s) {
+        m_sessions.removeOne(s);
+        emit sessionFinished(s);
+        s->deleteLater();
+        pump();
+    });
+    pump();
+}
+
+DisassemblySession *JobManager::sessionFor(const QWidget *view) const {
+    for (DisassemblySession *s : m_sessions) {
+        if (view && s->view() == view) return s;
+    }
+    return nullptr;
+}
+
+int JobManager::running() const {
+    int n = 0;
+    for (DisassemblySession *s : m_sessions) n += s->state() == DisassemblySession::State::Running;
+    return n;
+}
+
+void JobManager::pump() {
+    // Oldest first / 먼저 들어온 순서
+    int slots = m_maxConcurrent - running();
+    for (int i = 0; i < m_sessions.size() && slots > 0;) {
+        DisassemblySession *s = m_sessions[i];
+        if (s->state() != DisassemblySession::State::Queued) {
+            ++i;
+        } else if (!s->view()) {
+            m_sessions.removeAt(i);
+            s->deleteLater();
+        } else {
+            s->start();
+            emit sessionStarted(s);
+            --slots;
+            ++i;
+        }
+    }
+}
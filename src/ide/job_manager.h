@@ -0,0 +1,102 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Job Manager Header - Per-tab disassembly sessions and a bounded job queue
+ */
+#ifndef JOB_MANAGER_H
+#define JOB_MANAGER_H
+
+#include <QObject>
+#include <QPointer>
+#include <QList>
+#include <atomic>
+#include <memory>
+#include <string>
+#include "listing_view.h"
+#include "../progress.h"
+#include "../result_cache.h"
+
+class QThread;
+
+/**
+ * @brief One disassembly bound to one tab / 하나의 탭에 묶인 하나의 역어셈블
+ *
+ * The session owns the worker thread and the progress counters and writes only into its
+ * own view's feed, so switching tabs or opening another binary never redirects output.
+ * 세션은 작업 스레드와 진행률 카운터를 소유하고 자기 뷰의 피드에만 기록하므로, 탭을 바꾸거나
+ * 다른 바이너리를 열어도 출력이 다른 곳으로 가지 않습니다.
+ */
+class DisassemblySession : public QObject {
+    Q_OBJECT
+public:
+    enum class State { Queued, Running, Finished };
+
+    DisassemblySession(const QString &file, const QString &arch, int jobs, ResultCache &cache,
+                       ListingView *view, QObject *parent = nullptr);
+    // Stops objdump and waits for the worker, which uses this session and the cache
+    // objdump를 멈추고 이 세션과 캐시를 쓰는 작업 스레드를 대기
+    ~DisassemblySession() override;
+
+    void start();
+    State state() const { return m_state; }
+    const QString &file() const { return m_file; }
+    QString name() const;
+    QString mode() const; // "x86-64, -j4" / "x86-64, cached"
+    ListingView *view() const { return m_view; } // Null once the tab is closed / 탭이 닫히면 null
+    const std::string &graphKey() const { return m_graphKey; } // Valid once finished / 완료 후 유효
+    bool failed() const { return m_failed; } // No complete listing was produced / 완전한 목록을 만들지 못함
+
+    // 0-100, and "85.1 MB/s  ETA 3s" while the rate is known / 상태 표시줄용, 속도를 알 때만 표시
+    int percent() const;
+    QString rateText() const;
+
+signals:
+    void finished(DisassemblySession *session);
+
+private:
+    QString m_file;
+    QString m_arch;
+    int m_jobs;
+    ResultCache &m_cache;
+    QPointer<ListingView> m_view;
+    std::shared_ptr<ListingFeed> m_feed; // Kept past a closed tab until the worker stops / 작업 종료까지 유지
+    CodeProgress m_progress;
+    long long m_fileSize;
+    std::string m_graphKey; // Set by the worker / 작업 스레드가 설정
+    std::atomic<bool> m_cacheHit{false};
+    std::atomic<bool> m_failed{false};
+    std::atomic<bool> m_cancel{false}; // Set on destruction, stops objdump / 소멸 시 설정되어 objdump 중지
+    QThread *m_worker = nullptr;
+    State m_state = State::Queued;
+};
+
+/**
+ * @brief Runs sessions with at most maxConcurrent() at a time / 최대 maxConcurrent()개씩 세션 실행
+ * Sessions whose tab closes while queued are dropped without starting.
+ * 대기 중 탭이 닫힌 세션은 시작하지 않고 제거합니다.
+ */
+class JobManager : public QObject {
+    Q_OBJECT
+public:
+    explicit JobManager(int maxConcurrent, QObject *parent = nullptr);
+
+    int maxConcurrent() const { return m_maxConcurrent; }
+    void setMaxConcurrent(int n);
+    // Takes ownership and starts it once a slot is free / 소유권을 가져가 빈 자리가 나면 시작
+    void submit(DisassemblySession *session);
+    const QList<DisassemblySession *> &sessions() const { return m_sessions; }
+    DisassemblySession *sessionFor(const QWidget *view) const;
+    int running() const;
+
+signals:
+    void sessionStarted(DisassemblySession *session);
+    // The session is deleted after this returns / 반환 후 세션은 삭제됨
+    void sessionFinished(DisassemblySession *session);
+
+private:
+    void pump();
+
+    QList<DisassemblySession *> m_sessions;
+    int m_maxConcurrent;
+};
+
+#endif // JOB_MANAGER_H
@@ -0,0 +1,268 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Listing View Implementation - Painting, scrolling and selection over a line store
+ */
+#include "listing_view.h"
+#include <QApplication>
+#include <QClipboard>
+#include <QFontDatabase>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QScrollBar>
+#include <QTextLayout>
+#include <climits>
+#include "highlighter.h"
+
+namespace {
+constexpr int kTextMargin = 4; // Pixels between the gutter and the text / 여백과 텍스트 사이 픽셀
+}
+
+ListingView::ListingView(QWidget *parent, bool records)
+    : QAbstractScrollArea(parent), m_feed(std::make_shared<ListingFeed>(records)) {
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    setFocusPolicy(Qt::StrongFocus);
+    m_highlighter = new AsmHighlighter(nullptr);
+    m_highlighter->setParent(this); // Found by findChild like the editor's / 에디터처럼 findChild로 찾음
+    m_lineNumberArea = new LineNumberArea(this, this);
+    setViewportMargins(lineNumberAreaWidth(), 0, 0, 0);
+    verticalScrollBar()->setSingleStep(1);
+    updateScrollBars();
+
+    // Polled rather than signalled, so a fast producer costs one repaint per frame
+    // 신호 대신 폴링하여 빠른 생산자도 프레임당 한 번만 다시 그림
+    m_frameTimer.setInterval(1000 / kFrameRate);
+    connect(&m_frameTimer, &QTimer::timeout, this, &ListingView::refresh);
+    m_frameTimer.start();
+}
+
+ListingView::~ListingView() {
+    // A producer may still hold the feed; its output is no longer wanted / 생산자가 피드를 잡고 있을 수 있으나 출력은 더 이상 불필요
+    m_feed->abandon();
+}
+
+void ListingView::appendOutput(const QByteArray &data) {
+    m_feed->write(data.constData(), static_cast<size_t>(data.size()));
+}
+
+void ListingView::finishOutput() {
+    m_feed->finish();
+    m_frameTimer.stop();
+    refresh();
+}
+
+void ListingView::refresh() {
+    // The count is final once the feed reports finished / 피드가 완료되면 행 수가 확정됨
+    if (m_feed->isFinished()) m_frameTimer.stop();
+    size_t count = m_feed->lineCount();
+    if (count == m_lines) return;
+
+    // Keep following the end while the view sits at the bottom / 뷰가 맨 아래에 있으면 끝을 계속 따라감
+    QScrollBar *bar = verticalScrollBar();
+    bool follow = bar->value() == bar->maximum();
+    m_lines = count;
+
+    int digits = QString::number(qMax<qulonglong>(1, m_lines)).length();
+    if (digits != m_digits) {
+        m_digits = digits;
+        setViewportMargins(lineNumberAreaWidth(), 0, 0, 0);
+        QRect cr = contentsRect();
+        m_lineNumberArea->setGeometry(QRect(cr.left(), cr.top(), lineNumberAreaWidth(), cr.height()));
+    }
+    updateScrollBars();
+    if (follow) bar->setValue(bar->maximum());
+    viewport()->update();
+    m_lineNumberArea->update();
+}
+
+void ListingView::setDarkMode(bool dark) {
+    m_dark = dark;
+    m_highlighter->setDarkMode(dark);
+    viewport()->update();
+    m_lineNumberArea->update();
+}
+
+int ListingView::lineHeight() const {
+    return qMax(1, fontMetrics().lineSpacing());
+}
+
+size_t ListingView::firstVisibleLine() const {
+    return static_cast<size_t>(verticalScrollBar()->value());
+}
+
+size_t ListingView::lineAt(int y) const {
+    size_t line = firstVisibleLine() + static_cast<size_t>(qMax(0, y) / lineHeight());
+    size_t count = m_lines;
+    return count == 0 ? 0 : qMin(line, count - 1);
+}
+
+void ListingView::updateScrollBars() {
+    int visible = qMax(1, viewport()->height() / lineHeight());
+    size_t count = m_lines;
+    size_t last = count > static_cast<size_t>(visible) ? count - static_cast<size_t>(visible) : 0;
+    // Listings past INT_MAX lines stop scrolling there / INT_MAX 행을 넘는 부분은 스크롤 불가
+    verticalScrollBar()->setRange(0, static_cast<int>(qMin<size_t>(last, INT_MAX)));
+    verticalScrollBar()->setPageStep(visible);
+
+    // Byte length estimates the width before a line has been laid out / 배치 전에는 바이트 길이로 너비 추정
+    int estimate = static_cast<int>(qMin<size_t>(m_feed->longestLine(), 1 << 16)) * fontMetrics().horizontalAdvance(QLatin1Char('0'));
+    int width = qMax(m_contentWidth, estimate) + 2 * kTextMargin;
+    horizontalScrollBar()->setRange(0, qMax(0, width - viewport()->width()));
+    horizontalScrollBar()->setPageStep(viewport()->width());
+}
+
+void ListingView::paintEvent(QPaintEvent *event) {
+    QPainter painter(viewport());
+    painter.fillRect(event->rect(), m_dark ? QColor("#1a1a1b") : QColor("#ffffff"));
+
+    QColor text = m_dark ? QColor("#e8eaed") : QColor("#202124");
+    QColor selection = m_dark ? QColor("#264f78") : QColor("#cfe2fc");
+    QColor current = m_dark ? QColor("#262628") : QColor("#f1f3f4");
+    size_t lo = qMin(m_anchor, m_current), hi = qMax(m_anchor, m_current);
+
+    int lh = lineHeight();
+    int x = kTextMargin - horizontalScrollBar()->value();
+    int widest = m_contentWidth;
+    size_t count = m_lines;
+    size_t line = firstVisibleLine();
+    for (int y = 0; y < viewport()->height() && line < count; y += lh, ++line) {
+        if (y + lh < event->rect().top() || y > event->rect().bottom()) continue;
+        if (line >= lo && line <= hi) {
+            painter.fillRect(QRect(0, y, viewport()->width(), lh), lo == hi ? current : selection);
+        }
+        std::string raw = m_feed->line(line);
+        QString str = QString::fromStdString(raw);
+        QTextLayout layout(str, font());
+        layout.setFormats(m_highlighter->formatLine(str));
+        layout.beginLayout();
+        QTextLine tl = layout.createLine();
+        layout.endLayout();
+        widest = qMax(widest, static_cast<int>(tl.naturalTextWidth()));
+        painter.setPen(text);
+        layout.draw(&painter, QPointF(x, y));
+    }
+    if (widest > m_contentWidth) {
+        m_contentWidth = widest;
+        updateScrollBars();
+    }
+}
+
+void ListingView::resizeEvent(QResizeEvent *event) {
+    QAbstractScrollArea::resizeEvent(event);
+    QRect cr = contentsRect();
+    m_lineNumberArea->setGeometry(QRect(cr.left(), cr.top(), lineNumberAreaWidth(), cr.height()));
+    updateScrollBars();
+}
+
+void ListingView::scrollContentsBy(int, int) {
+    viewport()->update();
+    m_lineNumberArea->update();
+}
+
+int ListingView::lineNumberAreaWidth() {
+    return 3 + fontMetrics().horizontalAdvance(QLatin1Char('9')) * m_digits;
+}
+
+void ListingView::lineNumberAreaPaintEvent(QPaintEvent *event) {
+    QPainter painter(m_lineNumberArea);
+    painter.fillRect(event->rect(), m_dark ? QColor("#2b2b2b") : QColor("#f1f3f4"));
+    painter.setPen(m_dark ? QColor("#858585") : QColor("#5f6368"));
+
+    int lh = lineHeight();
+    size_t count = m_lines;
+    size_t line = firstVisibleLine();
+    for (int y = 0; y <= event->rect().bottom() && line < count; y += lh, ++line) {
+        if (y + lh < event->rect().top()) continue;
+        painter.drawText(0, y, m_lineNumberArea->width() - 2, lh, Qt::AlignRight, QString::number(line + 1));
+    }
+}
+
+void ListingView::setCurrentLine(size_t line, bool extend) {
+    m_current = line;
+    if (!extend) m_anchor = line;
+    ensureVisible(line, false);
+    viewport()->update();
+}
+
+void ListingView::ensureVisible(size_t line, bool center) {
+    int visible = qMax(1, viewport()->height() / lineHeight());
+    size_t first = firstVisibleLine();
+    if (!center && line >= first && line < first + static_cast<size_t>(visible)) return;
+    size_t top = center ? line - qMin<size_t>(line, static_cast<size_t>(visible / 2))
+                        : (line < first ? line : line - static_cast<size_t>(visible) + 1);
+    verticalScrollBar()->setValue(static_cast<int>(qMin<size_t>(top, INT_MAX)));
+}
+
+void ListingView::mousePressEvent(QMouseEvent *event) {
+    if (event->button() != Qt::LeftButton || m_lines == 0) return;
+    setCurrentLine(lineAt(event->pos().y()), event->modifiers() & Qt::ShiftModifier);
+}
+
+void ListingView::mouseMoveEvent(QMouseEvent *event) {
+    if (!(event->buttons() & Qt::LeftButton) || m_lines == 0) return;
+    setCurrentLine(lineAt(event->pos().y()), true);
+}
+
+void ListingView::keyPressEvent(QKeyEvent *event) {
+    if (event->matches(QKeySequence::Copy)) {
+        copySelection();
+        return;
+    }
+    size_t count = m_lines;
+    if (count == 0) return;
+    size_t page = static_cast<size_t>(qMax(1, viewport()->height() / lineHeight()));
+    size_t line = m_current;
+    switch (event->key()) {
+    case Qt::Key_Up: line = line > 0 ? line - 1 : 0; break;
+    case Qt::Key_Down: line = qMin(line + 1, count - 1); break;
+    case Qt::Key_PageUp: line = line > page ? line - page : 0; break;
+    case Qt::Key_PageDown: line = qMin(line + page, count - 1); break;
+    case Qt::Key_Home: line = 0; break;
+    case Qt::Key_End: line = count - 1; break;
+    default:
+        QAbstractScrollArea::keyPressEvent(event);
+        return;
+    }
+    setCurrentLine(line, event->modifiers() & Qt::ShiftModifier);
+}
+
+void ListingView::copySelection() const {
+    QByteArray text;
+    for (size_t line = qMin(m_anchor, m_current); line <= qMax(m_anchor, m_current); ++line) {
+        std::string raw = m_feed->line(line);
+        if (text.size() + static_cast<int>(raw.size()) > kMaxCopyBytes) break;
+        text.append(raw.data(), static_cast<int>(raw.size()));
+        text.append('\n');
+    }
+    QApplication::clipboard()->setText(QString::fromUtf8(text));
+}
+
+bool ListingView::goTo(const QString &query) {
+    QString hex = query.startsWith("0x", Qt::CaseInsensitive) ? query.mid(2) : query;
+    bool isHex = false;
+    qulonglong addr = hex.toULongLong(&isHex, 16);
+    std::string symbol = query.toStdString();
+
+    // Records may still be growing on the feed thread / 레코드가 피드 스레드에서 아직 늘어나는 중일 수 있음
+    size_t row = m_feed->withRecords([&](const Listing &listing) {
+        size_t found = isHex ? listing.rowOfAddress(addr) : Listing::npos;
+        if (found != Listing::npos) return found;
+        uint32_t sym = listing.findSymbol(symbol);
+        if (sym == Listing::npos) return found;
+        // Prefer the definition, then the first reference / 정의 우선, 없으면 첫 참조
+        for (uint32_t fn = 0; fn < listing.functionCount() && found == Listing::npos; ++fn) {
+            if (listing.functionSymbol(fn) == sym) found = listing.functionRow(fn);
+        }
+        if (found == Listing::npos) {
+            std::vector<size_t> refs = listing.rowsReferencing(sym);
+            if (!refs.empty()) found = refs.front();
+        }
+        return found;
+    });
+
+    if (row == Listing::npos || row >= m_lines) return false;
+    m_current = m_anchor = row;
+    ensureVisible(row, true);
+    viewport()->update();
+    return true;
+}
@@ -0,0 +1,112 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Listing View Header - Virtualized viewer over a memory-mapped line store
+ */
+#ifndef LISTING_VIEW_H
+#define LISTING_VIEW_H
+
+#include <QAbstractScrollArea>
+#include <QTimer>
+#include <QWidget>
+#include <memory>
+#include "../listing_feed.h"
+
+class AsmHighlighter;
+
+/**
+ * @brief Widgets that draw a line-number gutter / 행 번호 여백을 그리는 위젯
+ */
+class LineNumberHost {
+public:
+    virtual ~LineNumberHost() = default;
+    virtual int lineNumberAreaWidth() = 0;
+    virtual void lineNumberAreaPaintEvent(QPaintEvent *event) = 0;
+};
+
+class LineNumberArea : public QWidget {
+public:
+    LineNumberArea(QWidget *parent, LineNumberHost *host) : QWidget(parent), m_host(host) {}
+    QSize sizeHint() const override { return QSize(m_host->lineNumberAreaWidth(), 0); }
+
+protected:
+    void paintEvent(QPaintEvent *event) override { m_host->lineNumberAreaPaintEvent(event); }
+
+private:
+    LineNumberHost *m_host;
+};
+
+/**
+ * @brief Read-only listing view that paints only the visible lines / 보이는 행만 그리는 읽기 전용 목록 뷰
+ *
+ * Output is appended to a LineStore, so a multi-GB listing costs a file on disk and a
+ * sparse index rather than a QTextDocument; each paint lays out the few dozen lines on
+ * screen and highlights them on the spot. Disassembly views also keep parsed records for
+ * search and the graph.
+ * 출력은 LineStore에 추가되므로 수 GB 목록도 QTextDocument 대신 디스크 파일과 희소 색인만 차지합니다.
+ * 그릴 때마다 화면의 수십 행만 배치하고 즉석에서 강조하며, 역어셈블 뷰는 검색과 그래프용 레코드도 유지합니다.
+ *
+ * Indexing and parsing happen on the feed's thread; the view picks up new lines at most
+ * kFrameRate times a second, however many chunks arrived in between.
+ * 색인과 파싱은 피드 스레드에서 수행되며, 뷰는 그 사이 청크 수와 관계없이 초당 최대 kFrameRate번 새 행을 반영합니다.
+ */
+class ListingView : public QAbstractScrollArea, public LineNumberHost {
+    Q_OBJECT
+public:
+    static constexpr int kMaxCopyBytes = 64 << 20; // Clipboard cap / 클립보드 한도
+    static constexpr int kFrameRate = 30;          // Refreshes per second while streaming / 스트리밍 중 초당 갱신 횟수
+
+    // records: parse the listing for Go To and the graph / Go To와 그래프를 위해 목록 파싱
+    explicit ListingView(QWidget *parent = nullptr, bool records = false);
+    ~ListingView() override;
+
+    // Producers on any thread write here; the feed outlives a closed tab until they let go
+    // 모든 스레드의 생산자가 여기에 기록하며, 탭이 닫혀도 생산자가 놓을 때까지 피드는 유지됨
+    std::shared_ptr<ListingFeed> feed() const { return m_feed; }
+    // Streams raw bytes into the store, and into the records and graph when kept
+    // 바이트를 저장소에, 레코드를 유지하면 레코드와 그래프에도 스트리밍
+    void appendOutput(const QByteArray &data);
+    // Waits for the feed, finalizes the graph and shows the last lines. A feed finished on
+    // another thread is picked up by the next frame instead. / 피드 완료 대기 후 그래프 완성 및 마지막 행 표시,
+    // 다른 스레드에서 완료된 피드는 다음 프레임에 반영
+    void finishOutput();
+    // Complete once finishOutput() returned / finishOutput() 이후 완전함
+    const Listing &listing() const { return m_feed->listing(); }
+    const ControlFlowGraph &graph() const { return m_feed->graph(); }
+    bool goTo(const QString &query); // Hex address or symbol / 16진수 주소 또는 심볼
+    bool saveTo(const QString &path) const { return m_feed->saveTo(path.toStdString()); }
+    void setDarkMode(bool dark);
+
+    int lineNumberAreaWidth() override;
+    void lineNumberAreaPaintEvent(QPaintEvent *event) override;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void scrollContentsBy(int dx, int dy) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void keyPressEvent(QKeyEvent *event) override;
+
+private:
+    int lineHeight() const;
+    size_t firstVisibleLine() const;
+    size_t lineAt(int y) const;
+    void updateScrollBars();
+    void refresh(); // Picks up lines indexed since the last frame / 지난 프레임 이후 색인된 행 반영
+    void setCurrentLine(size_t line, bool extend);
+    void ensureVisible(size_t line, bool center);
+    void copySelection() const;
+
+    std::shared_ptr<ListingFeed> m_feed;
+    QTimer m_frameTimer;
+    size_t m_lines = 0; // Lines shown, fixed between frames / 표시 중인 행 수, 프레임 사이 고정
+    AsmHighlighter *m_highlighter;
+    LineNumberArea *m_lineNumberArea;
+    bool m_dark = true;
+    size_t m_current = 0; // Cursor line / 커서 행
+    size_t m_anchor = 0;  // Other end of the selection / 선택의 다른 끝
+    int m_contentWidth = 0; // Widest line laid out so far, in pixels / 지금까지 배치된 최대 행 너비
+    int m_digits = 1;
+};
+
+#endif // LISTING_VIEW_H
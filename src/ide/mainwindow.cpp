@@ -9,7 +9,6 @@
 #include <QAction>
 #include <QFileDialog>
 #include <QMessageBox>
-#include <QProcess>
 #include <QCheckBox>
 #include <QVBoxLayout>
 #include <QFile>
@@ -27,8 +26,13 @@
 #include <QThread>
 #include <QTextBlock>
 #include <QSettings>
+#include <QInputDialog>
+#include <QPointer>
+#include <QFutureWatcher>
+#include <QtConcurrent>
 #include "../visualizer.h"
-#include "../strings_extractor.h"
+#include "../binary_info.h"
+#include "../strings_sink.h"
 #include "../python_rev.h"
 
 /**
@@ -77,12 +81,20 @@ MainWindow::MainWindow(QWidget *parent)
 
     // Persistence: Load settings / 지속성: 설정 로드
     QSettings settings("Rheehose", "thedecoder");
+    // Extra language of "key = text" lines, shared format with the CLI / CLI와 같은 형식의 추가 언어
+    QString languageFile = settings.value("languageFile").toString();
+    if (!languageFile.isEmpty()) I18n::instance().loadLanguage(languageFile.toStdString());
     Language lang = static_cast<Language>(settings.value("language", static_cast<int>(Language::KO)).toInt());
     I18n::instance().setLanguage(lang);
     
     m_isDarkMode = settings.value("darkMode", true).toBool();
+    m_jobs = qMax(1, settings.value("jobs", QThread::idealThreadCount()).toInt());
+    m_jobManager = new JobManager(settings.value("maxJobs", 2).toInt(), this);
+    connect(m_jobManager, &JobManager::sessionStarted, this, [this](DisassemblySession *s) {
+        statusBar()->showMessage(I18n::instance().get(Msg::Disassembling).data() + QString(" (") + s->mode() + "): " + s->file());
+    });
+    connect(m_jobManager, &JobManager::sessionFinished, this, &MainWindow::sessionFinished);
 
-    m_proc = new QProcess(this);
     m_tabs = new QTabWidget(this);
     m_tabs->setTabsClosable(true);
     connect(m_tabs, &QTabWidget::tabCloseRequested, this, &MainWindow::closeTab);
@@ -106,47 +118,69 @@ MainWindow::MainWindow(QWidget *parent)
     applyTheme();
 }
 
+MainWindow::~MainWindow()
+{
+    // Workers write into tab feeds and use m_cache, so they stop before any member goes; an
+    // abandoned feed drops their remaining output / 작업 스레드는 탭 피드와 m_cache를 쓰므로 멤버보다 먼저 종료하며,
+    // 버려진 피드는 남은 출력을 버림
+    for (ListingView *view : findChildren<ListingView*>()) view->feed()->abandon();
+    delete m_jobManager; // Each session stops objdump and waits / 각 세션이 objdump를 멈추고 대기
+    // Graph tasks read m_cache; cancelled ones may still be finishing their feed
+    // 그래프 작업은 m_cache를 읽으며, 취소된 작업도 피드 완료 처리 중일 수 있음
+    for (const GraphJob &job : m_graphJobs) *job.cancel = true;
+    for (QFutureWatcherBase *watcher : findChildren<QFutureWatcherBase*>()) watcher->waitForFinished();
+    for (QThread *worker : m_stringsWorkers) {
+        worker->wait();
+        delete worker;
+    }
+}
+
 void MainWindow::setupToolbar() {
     QToolBar *tb = addToolBar("Main");
     tb->setMovable(false);
 
-    m_openAct = new QAction(I18n::instance().get("open_binary").c_str(), this);
+    m_openAct = new QAction(I18n::instance().get(Msg::OpenBinary).data(), this);
     connect(m_openAct, &QAction::triggered, this, &MainWindow::openBinary);
     tb->addAction(m_openAct);
 
-    m_saveAct = new QAction(I18n::instance().get("save_asm").c_str(), this);
+    m_saveAct = new QAction(I18n::instance().get(Msg::SaveAsm).data(), this);
     connect(m_saveAct, &QAction::triggered, this, &MainWindow::saveAsm);
     tb->addAction(m_saveAct);
 
-    m_saveAsAct = new QAction(I18n::instance().get("save_as").c_str(), this);
+    m_saveAsAct = new QAction(I18n::instance().get(Msg::SaveAs).data(), this);
     connect(m_saveAsAct, &QAction::triggered, this, &MainWindow::saveAs);
     tb->addAction(m_saveAsAct);
 
     tb->addSeparator();
 
-    m_pythonAct = new QAction(I18n::instance().get("python_rev").c_str(), this);
+    m_pythonAct = new QAction(I18n::instance().get(Msg::PythonRev).data(), this);
     connect(m_pythonAct, &QAction::triggered, this, &MainWindow::runPythonRev);
     tb->addAction(m_pythonAct);
 
-    m_interpretedAct = new QAction(I18n::instance().get("interpreted_rev").c_str(), this);
+    m_interpretedAct = new QAction(I18n::instance().get(Msg::InterpretedRev).data(), this);
     connect(m_interpretedAct, &QAction::triggered, this, &MainWindow::runInterpretedRev);
     tb->addAction(m_interpretedAct);
 
-    m_stringsAct = new QAction(I18n::instance().get("extract_strings").c_str(), this);
+    m_stringsAct = new QAction(I18n::instance().get(Msg::ExtractStrings).data(), this);
     connect(m_stringsAct, &QAction::triggered, this, &MainWindow::extractStrings);
     tb->addAction(m_stringsAct);
 
+    m_gotoAct = new QAction(I18n::instance().get(Msg::GoTo).data(), this);
+    m_gotoAct->setShortcut(QKeySequence(Qt::CTRL | Qt::Key_G));
+    connect(m_gotoAct, &QAction::triggered, this, &MainWindow::goToLocation);
+    tb->addAction(m_gotoAct);
+
     tb->addSeparator();
 
-    m_langAct = new QAction(I18n::instance().get("lang_toggle").c_str(), this);
+    m_langAct = new QAction(I18n::instance().get(Msg::LangToggle).data(), this);
     connect(m_langAct, &QAction::triggered, this, &MainWindow::toggleLanguage);
     tb->addAction(m_langAct);
 
-    m_themeAct = new QAction(I18n::instance().get("theme_toggle").c_str(), this);
+    m_themeAct = new QAction(I18n::instance().get(Msg::ThemeToggle).data(), this);
     connect(m_themeAct, &QAction::triggered, this, &MainWindow::toggleTheme);
     tb->addAction(m_themeAct);
 
-    m_readOnlyAct = new QAction(I18n::instance().get("read_only").c_str(), this);
+    m_readOnlyAct = new QAction(I18n::instance().get(Msg::ReadOnly).data(), this);
     m_readOnlyAct->setCheckable(true);
     m_readOnlyAct->setChecked(true);
     connect(m_readOnlyAct, &QAction::triggered, this, &MainWindow::toggleReadOnly);
@@ -157,33 +191,36 @@ void MainWindow::setupStatusBar() {
     m_progressBar = new QProgressBar(this);
     m_progressBar->setVisible(false);
     m_progressBar->setMaximumHeight(15);
+    m_jobsLabel = new QLabel(this);
+    m_jobsLabel->setVisible(false);
+    statusBar()->addPermanentWidget(m_jobsLabel);
     statusBar()->addPermanentWidget(m_progressBar);
 
-    connect(m_proc, &QProcess::readyReadStandardOutput, this, &MainWindow::readProcOutput);
-    connect(m_proc, &QProcess::readyReadStandardError, this, &MainWindow::readProcError);
-    connect(m_proc, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this, &MainWindow::procFinished);
+    m_progressTimer.setInterval(1000 / ListingView::kFrameRate);
+    connect(&m_progressTimer, &QTimer::timeout, this, &MainWindow::updateProgress);
 
-    statusBar()->showMessage(I18n::instance().get("ready").c_str());
+    statusBar()->showMessage(I18n::instance().get(Msg::Ready).data());
 }
 
 void MainWindow::updateUiText() {
-    setWindowTitle(I18n::instance().get("app_title").c_str());
-    m_openAct->setText(I18n::instance().get("open_binary").c_str());
-    m_saveAct->setText(I18n::instance().get("save_asm").c_str());
-    m_saveAsAct->setText(I18n::instance().get("save_as").c_str());
-    m_langAct->setText(I18n::instance().get("lang_toggle").c_str());
-    m_themeAct->setText(I18n::instance().get("theme_toggle").c_str());
-    m_readOnlyAct->setText(I18n::instance().get("read_only").c_str());
-    m_pythonAct->setText(I18n::instance().get("python_rev").c_str());
-    m_interpretedAct->setText(I18n::instance().get("interpreted_rev").c_str());
-    m_stringsAct->setText(I18n::instance().get("extract_strings").c_str());
+    setWindowTitle(I18n::instance().get(Msg::AppTitle).data());
+    m_openAct->setText(I18n::instance().get(Msg::OpenBinary).data());
+    m_saveAct->setText(I18n::instance().get(Msg::SaveAsm).data());
+    m_saveAsAct->setText(I18n::instance().get(Msg::SaveAs).data());
+    m_langAct->setText(I18n::instance().get(Msg::LangToggle).data());
+    m_themeAct->setText(I18n::instance().get(Msg::ThemeToggle).data());
+    m_readOnlyAct->setText(I18n::instance().get(Msg::ReadOnly).data());
+    m_pythonAct->setText(I18n::instance().get(Msg::PythonRev).data());
+    m_interpretedAct->setText(I18n::instance().get(Msg::InterpretedRev).data());
+    m_stringsAct->setText(I18n::instance().get(Msg::ExtractStrings).data());
+    m_gotoAct->setText(I18n::instance().get(Msg::GoTo).data());
     
     if (m_progressBar->isVisible()) {
-        statusBar()->showMessage(I18n::instance().get("disassembling").c_str());
+        statusBar()->showMessage(I18n::instance().get(Msg::Disassembling).data());
     } else if (!m_lastStatusMsg.isEmpty()) {
         statusBar()->showMessage(m_lastStatusMsg);
     } else {
-        statusBar()->showMessage(I18n::instance().get("ready").c_str());
+        statusBar()->showMessage(I18n::instance().get(Msg::Ready).data());
     }
 }
 
@@ -211,7 +248,7 @@ void MainWindow::applyTheme() {
                 background-color: #1a1a1b;
                 color: #e8eaed;
             }
-            QPlainTextEdit, AsmEditor {
+            QPlainTextEdit, AsmEditor, ListingView {
                 background-color: #1a1a1b;
                 color: #e8eaed;
                 border: 1px solid #3c4043;
@@ -263,7 +300,7 @@ void MainWindow::applyTheme() {
                 background-color: #ffffff;
                 color: #202124;
             }
-            QPlainTextEdit, AsmEditor {
+            QPlainTextEdit, AsmEditor, ListingView {
                 background-color: #ffffff;
                 color: #202124;
                 border: 1px solid #dadce0;
@@ -315,6 +352,10 @@ void MainWindow::applyTheme() {
     // Update all highlighters in tabs / 탭 내의 모든 하이라이터 업데이트
     for (int i = 0; i < m_tabs->count(); ++i) {
         QWidget *w = m_tabs->widget(i);
+        if (ListingView *view = qobject_cast<ListingView*>(w)) {
+            view->setDarkMode(m_isDarkMode);
+            continue;
+        }
         AsmEditor *ed = qobject_cast<AsmEditor*>(w);
         if (ed) {
              // Find highlighter attached to document
@@ -337,64 +378,60 @@ void MainWindow::toggleReadOnly() {
     m_isReadOnly = m_readOnlyAct->isChecked();
 }
 
-void MainWindow::addEditorTab(const QString &title, const QString &content, bool isViz)
+void MainWindow::addEditorTab(const QString &title, const QString &content, bool isViz, bool activate)
 {
-    AsmEditor *ed = new AsmEditor(this);
-    if (!content.isEmpty()) {
-        loadLargeText(ed, content);
-    }
-    
-    if (!isViz) {
-        AsmHighlighter *hl = new AsmHighlighter(ed->document());
-        hl->setParent(ed); // Allow findChild from ed / ed에서 findChild 가능하게 함
-        hl->setDarkMode(m_isDarkMode); // Sync initial state / 초기 상태 동기화
+    QWidget *tab;
+    if (content.isEmpty() || content.size() > kLargeTextChars) {
+        // Painted from a mapped file, so size is no longer capped / 매핑된 파일에서 그리므로 크기 제한 없음
+        ListingView *view = new ListingView(this);
+        view->setDarkMode(m_isDarkMode);
+        if (!content.isEmpty()) {
+            view->appendOutput(content.toUtf8());
+            view->finishOutput();
+        }
+        tab = view;
     } else {
-        ed->setReadOnly(true);
-        ed->setStyleSheet("QPlainTextEdit { background-color: #1a1a1b; color: #8ab4f8; font-weight: bold; }");
+        AsmEditor *ed = new AsmEditor(this);
+        ed->setPlainText(content);
+        if (!isViz) {
+            AsmHighlighter *hl = new AsmHighlighter(ed->document());
+            hl->setParent(ed); // Allow findChild from ed / ed에서 findChild 가능하게 함
+            hl->setDarkMode(m_isDarkMode); // Sync initial state / 초기 상태 동기화
+        } else {
+            ed->setReadOnly(true);
+            ed->setStyleSheet("QPlainTextEdit { background-color: #1a1a1b; color: #8ab4f8; font-weight: bold; }");
+        }
+        tab = ed;
     }
-    int idx = m_tabs->addTab(ed, title);
-    m_tabs->setCurrentIndex(idx);
+    int idx = m_tabs->addTab(tab, title);
+    if (activate) m_tabs->setCurrentIndex(idx);
     checkDashboard();
 }
 
-void MainWindow::appendToCurrentTab(const QString &text) {
-    QWidget *w = m_tabs->currentWidget();
-    if (!w) return;
-    AsmEditor *ed = qobject_cast<AsmEditor*>(w);
-    if (!ed) return;
-
-    if (ed->document()->characterCount() > 5000000) return; 
-
-    ed->moveCursor(QTextCursor::End);
-    ed->insertPlainText(text);
-}
-
-void MainWindow::readProcOutput() {
-    QByteArray data = m_proc->readAllStandardOutput();
-    m_processedSize += data.size();
-    
-    if (m_totalExpectedSize > 0) {
-        double progress = (double)m_processedSize / (m_totalExpectedSize * 4.0);
-        if (progress > 0.99) progress = 0.99;
-        m_progressBar->setValue(progress * 100);
+void MainWindow::updateProgress() {
+    // One entry per job; the bar follows the job of the current tab / 작업마다 한 항목, 막대는 현재 탭의 작업을 따라감
+    QStringList jobs;
+    for (DisassemblySession *s : m_jobManager->sessions()) {
+        if (!s->view()) continue;
+        if (s->state() == DisassemblySession::State::Queued) {
+            jobs << s->name() + " " + I18n::instance().get(Msg::Queued).data();
+        } else {
+            jobs << s->name() + " " + QString::number(s->percent()) + "%";
+        }
     }
-
-    appendToCurrentTab(QString::fromLocal8Bit(data));
-}
-
-void MainWindow::readProcError() {
-    QByteArray data = m_proc->readAllStandardError();
-    appendToCurrentTab("\n--- stderr ---\n" + QString::fromLocal8Bit(data) + "\n");
-}
-
-void MainWindow::loadLargeText(AsmEditor *ed, const QString &content) {
-    if (content.length() > 5000000) { 
-        ed->setPlainText("--- WARNING: Large Output Truncated for Performance (Original size: " + QString::number(content.size()) + " chars) ---\n" +
-                         "Please use 'Save ASM' to view the full content.\n\n" +
-                         content.left(1000000));
-    } else {
-        ed->setPlainText(content);
+    m_jobsLabel->setText(jobs.join("  |  "));
+    m_jobsLabel->setVisible(jobs.size() > 1);
+
+    DisassemblySession *current = m_jobManager->sessionFor(m_tabs->currentWidget());
+    bool running = current && current->state() == DisassemblySession::State::Running;
+    m_progressBar->setVisible(running);
+    if (running) {
+        QString rate = current->rateText();
+        m_progressBar->setRange(0, 100);
+        m_progressBar->setValue(current->percent());
+        m_progressBar->setFormat(rate.isEmpty() ? QString("%p%") : "%p%  " + rate);
     }
+    if (m_jobManager->sessions().isEmpty()) m_progressTimer.stop();
 }
 
 void MainWindow::checkDashboard() {
@@ -404,19 +441,21 @@ void MainWindow::checkDashboard() {
 }
 
 void MainWindow::closeTab(int index) {
-    m_tabs->removeTab(index);
+    // Deleted so a running session sees its view gone / 실행 중인 세션이 뷰가 사라졌음을 알도록 삭제
+    QWidget *w = m_tabs->widget(index);
+    // Graph work for this listing, or for this [Map] tab, is now stale / 이 목록이나 이 [Map] 탭의 그래프 작업은 무효
+    for (int i = m_graphJobs.size() - 1; i >= 0; --i) {
+        if (m_graphJobs[i].mapTab == w) m_graphJobs[i].mapTab.clear();
+        if (m_graphJobs[i].source == w || !m_graphJobs[i].mapTab) cancelGraph(i);
+    }
+    m_tabs->removeTab(m_tabs->indexOf(w));
+    if (w) w->deleteLater();
     checkDashboard();
 }
 
 QString MainWindow::detectArch(const QString &path) {
-    QProcess p;
-    p.start("objdump", QStringList() << "-f" << path);
-    if (!p.waitForFinished(2000)) return "unknown";
-    QString out = p.readAllStandardOutput();
-    if (out.contains("i386:x86-64")) return "x86-64";
-    if (out.contains("i386")) return "i386";
-    if (out.contains("arm")) return "arm";
-    return "unknown";
+    // Native header read, no objdump round-trip / objdump 호출 없이 헤더 직접 읽기
+    return QString::fromStdString(BinaryInfo::load(path.toStdString()).arch);
 }
 
 void MainWindow::openBinary()
@@ -427,46 +466,132 @@ void MainWindow::openBinary()
 }
 
 void MainWindow::startDisassembly(const QString &file, const QString &arch) {
-    m_totalExpectedSize = QFileInfo(file).size();
-    m_processedSize = 0;
-    m_progressBar->setValue(0);
-    m_progressBar->setVisible(true);
-
-    QStringList args;
-    args << "-d";
-    if (arch == "x86-64" || arch == "i386") args << "-Mintel";
-    args << file;
-
+    // A new run of the same file supersedes any graph still being built for it / 같은 파일의 새 실행은 진행 중인 그래프를 대체
+    for (int i = m_graphJobs.size() - 1; i >= 0; --i) {
+        if (m_graphJobs[i].file == file) cancelGraph(i);
+    }
     m_currentAsmPath.clear();
-    addEditorTab(QFileInfo(file).fileName(), "");
-    
-    m_proc->start("objdump", args);
-    if (!m_proc->waitForStarted(3000)) {
-        QMessageBox::critical(this, "Error", "Failed to start objdump.");
-        m_progressBar->setVisible(false);
-    } else {
-        statusBar()->showMessage(I18n::instance().get("disassembling").c_str() + QString(" (") + arch + "): " + file);
+    // The only tab kind that parses records, for Go To and the graph / Go To와 그래프를 위해 레코드를 파싱하는 유일한 탭
+    ListingView *view = new ListingView(this, true);
+    view->setDarkMode(m_isDarkMode);
+    m_tabs->setCurrentIndex(m_tabs->addTab(view, QFileInfo(file).fileName()));
+    checkDashboard();
+    // Output goes to this tab's feed only, whichever tab is current / 현재 탭과 관계없이 이 탭의 피드로만 출력
+    DisassemblySession *session = new DisassemblySession(file, arch, m_jobs, m_cache, view);
+    m_jobManager->submit(session);
+    if (session->state() == DisassemblySession::State::Queued) {
+        statusBar()->showMessage(session->name() + ": " + I18n::instance().get(Msg::Queued).data());
     }
+    m_progressTimer.start();
+    updateProgress();
 }
 
-void MainWindow::procFinished(int exitCode, QProcess::ExitStatus status)
+void MainWindow::sessionFinished(DisassemblySession *session)
 {
-    Q_UNUSED(status)
-    m_progressBar->setValue(100);
-    m_progressBar->setVisible(false);
+    updateProgress();
+    ListingView *view = session->view();
+    if (session->failed()) {
+        // No graph for a failed run; the tab still shows objdump's stderr / 실패한 실행은 그래프 없이 탭에 stderr만 표시
+        if (view) view->finishOutput();
+        QMessageBox::critical(this, "Error", I18n::instance().get(Msg::ObjdumpFailed).data());
+        return;
+    }
+    if (!view) return; // Tab closed while running / 실행 중 탭이 닫힘
+    startGraph(session, view);
+}
 
-    QWidget *w = m_tabs->currentWidget();
-    if (w) {
-        AsmEditor *ed = qobject_cast<AsmEditor*>(w);
-        if (ed) {
-             QString display = ed->toPlainText();
-             std::string mermaid = Visualizer::generateMermaidCFG(display.toStdString());
-             addEditorTab(m_tabs->tabText(m_tabs->currentIndex()) + " [Map]", QString::fromStdString(mermaid), true);
+void MainWindow::startGraph(DisassemblySession *session, ListingView *view)
+{
+    // The [Map] tab appears at once and is filled in by the pool task; background jobs do not take focus
+    // [Map] 탭은 바로 나타나고 풀 작업이 채우며, 백그라운드 작업은 포커스를 가져가지 않음
+    bool current = m_tabs->currentWidget() == view;
+    addEditorTab(m_tabs->tabText(m_tabs->indexOf(view)) + " [Map]", I18n::instance().get(Msg::Visualizing).data(), true, current);
+    auto cancel = std::make_shared<std::atomic<bool>>(false);
+    m_graphJobs.append({view, m_tabs->widget(m_tabs->count() - 1), session->file(), cancel});
+    statusBar()->showMessage(I18n::instance().get(Msg::Visualizing).data() + QString(": ") + session->name());
+
+    std::shared_ptr<ListingFeed> feed = view->feed();
+    std::string graphKey = session->graphKey();
+    QString label = session->name() + ", " + session->mode();
+    ResultCache *cache = &m_cache; // The destructor waits for this task / 소멸자가 이 작업을 대기
+    QFutureWatcher<QByteArray> *watcher = new QFutureWatcher<QByteArray>(this);
+    connect(watcher, &QFutureWatcher<QByteArray>::finished, this, [this, watcher, cancel, feed, label]() {
+        watcher->deleteLater();
+        // Ingest throughput, from the first byte to the last indexed batch / 첫 바이트부터 마지막 색인 묶음까지의 수집 처리량
+        ListingFeed::Throughput t = feed->throughput();
+        QString status = QString("%1 (%2): %3 MB in %4 s (%5 MB/s)")
+                             .arg(I18n::instance().get(Msg::Finished).data())
+                             .arg(label)
+                             .arg(t.bytes / (1024.0 * 1024.0), 0, 'f', 1)
+                             .arg(t.seconds, 0, 'f', 2)
+                             .arg(t.mbps(), 0, 'f', 1);
+        graphFinished(cancel, watcher->result(), status);
+    });
+    watcher->setFuture(QtConcurrent::run([feed, cancel, graphKey, cache]() -> QByteArray {
+        // Finishing always runs, so the source tab gets its last lines even when the graph is dropped
+        // 그래프가 버려져도 원본 탭이 마지막 행을 받도록 완료 처리는 항상 수행
+        feed->finish();
+        if (*cancel) return QByteArray();
+        std::string cached = graphKey.empty() ? std::string() : cache->lookup(graphKey);
+        QFile cachedGraph(QString::fromStdString(cached));
+        if (!cached.empty() && cachedGraph.open(QIODevice::ReadOnly)) return cachedGraph.readAll();
+
+        // Graph was built while streaming; only rendering is left / 그래프는 스트리밍 중에 구축되어 렌더링만 남음
+        std::string rendered = Visualizer::renderMermaid(feed->graph(), cancel.get());
+        if (*cancel) return QByteArray();
+        if (!graphKey.empty() && feed->graph().functionCount() > 0) {
+            ResultCache::Writer store(*cache, graphKey);
+            store.write(rendered.data(), rendered.size());
+            store.commit();
         }
+        return QByteArray::fromStdString(rendered);
+    }));
+}
+
+void MainWindow::graphFinished(const std::shared_ptr<std::atomic<bool>> &cancel, const QByteArray &mermaid, const QString &status)
+{
+    for (int i = 0; i < m_graphJobs.size(); ++i) {
+        if (m_graphJobs[i].cancel != cancel) continue;
+        GraphJob job = m_graphJobs.takeAt(i);
+        if (*job.cancel || !job.mapTab) return;
+        fillMapTab(job.mapTab, mermaid);
+        m_lastStatusMsg = status;
+        statusBar()->showMessage(m_lastStatusMsg);
+        return;
     }
+    // Cancelled jobs were already removed / 취소된 작업은 이미 제거됨
+}
+
+void MainWindow::cancelGraph(int index)
+{
+    GraphJob job = m_graphJobs.takeAt(index);
+    *job.cancel = true;
+    if (job.mapTab) {
+        m_tabs->removeTab(m_tabs->indexOf(job.mapTab));
+        job.mapTab->deleteLater();
+        checkDashboard();
+    }
+}
 
-    m_lastStatusMsg = QString(I18n::instance().get("saved_to").c_str()) + m_currentAsmPath;
-    statusBar()->showMessage(m_lastStatusMsg);
+void MainWindow::fillMapTab(QWidget *placeholder, const QByteArray &mermaid)
+{
+    AsmEditor *ed = qobject_cast<AsmEditor*>(placeholder);
+    if (ed && mermaid.size() <= kLargeTextChars) {
+        ed->setPlainText(QString::fromUtf8(mermaid));
+        return;
+    }
+    // Too large for an editor, so swapped for a ListingView in place / 에디터에 너무 커서 같은 자리의 ListingView로 교체
+    int idx = m_tabs->indexOf(placeholder);
+    bool current = m_tabs->currentIndex() == idx;
+    QString title = m_tabs->tabText(idx);
+    ListingView *view = new ListingView(this);
+    view->setDarkMode(m_isDarkMode);
+    view->appendOutput(mermaid);
+    view->finishOutput();
+    m_tabs->removeTab(idx);
+    m_tabs->insertTab(idx, view, title);
+    if (current) m_tabs->setCurrentIndex(idx);
+    placeholder->deleteLater();
 }
 
 void MainWindow::saveAsm()
@@ -476,7 +601,12 @@ void MainWindow::saveAsm()
         return;
     }
     QWidget *w = m_tabs->currentWidget();
-    if (w) {
+    if (ListingView *view = qobject_cast<ListingView*>(w)) {
+        // Copied from the backing file, never through a QString / QString을 거치지 않고 저장 파일에서 복사
+        if (view->saveTo(m_currentAsmPath)) {
+            statusBar()->showMessage(I18n::instance().get(Msg::SavedTo).data() + m_currentAsmPath, 3000);
+        }
+    } else if (w) {
         AsmEditor *ed = qobject_cast<AsmEditor*>(w);
         if (ed) {
              QFile f(m_currentAsmPath);
@@ -484,7 +614,7 @@ void MainWindow::saveAsm()
                  QTextStream os(&f);
                  os << ed->toPlainText();
                  f.close();
-                 statusBar()->showMessage(I18n::instance().get("saved_to").c_str() + m_currentAsmPath, 3000);
+                 statusBar()->showMessage(I18n::instance().get(Msg::SavedTo).data() + m_currentAsmPath, 3000);
              }
         }
     }
@@ -502,20 +632,57 @@ void MainWindow::extractStrings() {
     if (fileName.isEmpty()) return;
     
     statusBar()->showMessage("Extracting strings...");
-    std::string result = StringsExtractor::extract(fileName.toStdString());
-    addEditorTab(QFileInfo(fileName).fileName() + " [Strings]", QString::fromStdString(result));
-    statusBar()->showMessage(I18n::instance().get("strings_finished").c_str(), 3000);
+    addEditorTab(QFileInfo(fileName).fileName() + " [Strings]", "");
+    QPointer<ListingView> ed = qobject_cast<ListingView*>(m_tabs->currentWidget());
+    std::shared_ptr<ListingFeed> feed = ed->feed();
+
+    // Tagged lines stream into the tab while the scan runs; the CLI's --unicode output is the same
+    // 스캔 중 태그된 행을 탭으로 스트리밍하며, CLI의 --unicode 출력과 동일
+    StringsSink::Options opts;
+    opts.file = fileName.toStdString();
+    opts.encodings = StringsExtractor::AllEncodings;
+    QThread *worker = QThread::create([this, feed, opts]() {
+        ListingFeed &out = *feed;
+        std::string key;
+        uint64_t content;
+        if (m_cache.isEnabled() && ResultCache::hashFile(opts.file, content)) {
+            key = ResultCache::key(content, "strings", ResultCache::stringsOptions(opts.minLength, opts.encodings, false, true));
+            std::string cached = m_cache.lookup(key);
+            if (!cached.empty() && ResultCache::stream(cached, out)) return;
+        }
+        std::unique_ptr<ResultCache::Writer> store;
+        TeeSink tee;
+        tee.add(&out);
+        if (!key.empty()) {
+            store = std::make_unique<ResultCache::Writer>(m_cache, key);
+            tee.add(store.get());
+        }
+        TextStringsSink lines(tee, true);
+        if (!StringsSink::run(opts, lines)) {
+            QMetaObject::invokeMethod(this, [this]() {
+                QMessageBox::critical(this, "Error", "Cannot open file for strings extraction.");
+            }, Qt::QueuedConnection);
+        } else if (store) {
+            store->commit();
+        }
+    });
+    m_stringsWorkers.append(worker);
+    connect(worker, &QThread::finished, this, [this, worker, ed]() {
+        m_stringsWorkers.removeOne(worker);
+        worker->deleteLater();
+        if (ed) ed->finishOutput();
+        statusBar()->showMessage(I18n::instance().get(Msg::StringsFinished).data(), 3000);
+    });
+    worker->start();
 }
 
 void MainWindow::runPythonRev() {
     QString infile = QFileDialog::getOpenFileName(this, "Select Python Binary (.exe)", "", "Executable Files (*.exe);;All Files (*)");
     if (infile.isEmpty()) return;
 
-    statusBar()->showMessage(I18n::instance().get("python_rev").c_str());
+    statusBar()->showMessage(I18n::instance().get(Msg::PythonRev).data());
     
-    AsmEditor *ed = new AsmEditor(this);
     QString log = QString::fromStdString(PythonRev::runFullSequence(infile.toStdString(), true));
-    loadLargeText(ed, log);
     addEditorTab(QFileInfo(infile).fileName() + " [PyRev Log]", log);
 
     // Monster Grade Automation: 5s Countdown / 몬스터 등급 자동화: 5초 카운트다운
@@ -555,14 +722,27 @@ void MainWindow::runInterpretedRev() {
     QString fileName = QFileDialog::getOpenFileName(this, "Select Script/Binary (JS/Ruby/Go)", "", "All Files (*)");
     if (fileName.isEmpty()) return;
 
-    statusBar()->showMessage(I18n::instance().get("interpreted_rev").c_str());
+    statusBar()->showMessage(I18n::instance().get(Msg::InterpretedRev).data());
     addEditorTab(QFileInfo(fileName).fileName() + " [Interpreted]", "# Interpreted Mode Engaged\n# Support for JS/Ruby/High-level Bytecode recovery in progress.\n# Signature: " + QFileInfo(fileName).suffix());
 }
 
+void MainWindow::goToLocation() {
+    ListingView *ed = qobject_cast<ListingView*>(m_tabs->currentWidget());
+    if (!ed) return;
+    bool ok = false;
+    QString query = QInputDialog::getText(this, I18n::instance().get(Msg::GoTo).data(),
+                                          I18n::instance().get(Msg::GoToPrompt).data(), QLineEdit::Normal, QString(), &ok);
+    if (!ok || query.trimmed().isEmpty()) return;
+    if (!ed->goTo(query.trimmed())) {
+        statusBar()->showMessage(I18n::instance().get(Msg::GoToNotFound).data() + QString(": ") + query, 3000);
+    }
+}
+
 // --- AsmEditor Implementation ---
 
-AsmEditor::AsmEditor(QWidget *parent) : QPlainTextEdit(parent) {
-    m_lineNumberArea = new LineNumberArea(this);
+AsmEditor::AsmEditor(QWidget *parent)
+    : QPlainTextEdit(parent) {
+    m_lineNumberArea = new LineNumberArea(this, this);
 
     connect(this, &QPlainTextEdit::blockCountChanged, this, &AsmEditor::updateLineNumberAreaWidth);
     connect(this, &QPlainTextEdit::updateRequest, this, &AsmEditor::updateLineNumberArea);
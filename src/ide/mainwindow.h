@@ -11,30 +11,42 @@
 #include <QHeaderView>
 #include <QFileDialog>
 #include <QMessageBox>
-#include <QProcess>
+#include <QTimer>
+#include <QPointer>
 #include <QFileInfo>
 #include <QAction>
 #include <QToolBar>
 #include <QStatusBar>
 #include <QLabel>
 #include <QProgressBar>
+#include <QThread>
 #include <QCheckBox>
 #include <QPainter>
 #include <QTextBlock>
 #include "../i18n.h"
 #include "../visualizer.h"
+#include "../listing.h"
+#include "../control_flow.h"
+#include "../stream_sink.h"
+#include "../result_cache.h"
+#include "../progress.h"
+#include "listing_view.h"
+#include "job_manager.h"
+#include <atomic>
+#include <memory>
 
 class DashboardWidget;
 
 /**
  * @brief Custom Text Editor with Line Numbers / 행 번호가 포함된 커스텀 텍스트 에디터
+ * For small, editable text; listings go to ListingView. / 작고 편집 가능한 텍스트용, 목록은 ListingView 사용
  */
-class AsmEditor : public QPlainTextEdit {
+class AsmEditor : public QPlainTextEdit, public LineNumberHost {
     Q_OBJECT
 public:
     AsmEditor(QWidget *parent = nullptr);
-    void lineNumberAreaPaintEvent(QPaintEvent *event);
-    int lineNumberAreaWidth();
+    void lineNumberAreaPaintEvent(QPaintEvent *event) override;
+    int lineNumberAreaWidth() override;
 
 protected:
     void resizeEvent(QResizeEvent *event) override;
@@ -48,25 +60,13 @@ private:
     QWidget *m_lineNumberArea;
 };
 
-class LineNumberArea : public QWidget {
-public:
-    LineNumberArea(AsmEditor *editor) : QWidget(editor), m_editor(editor) {}
-    QSize sizeHint() const override { return QSize(m_editor->lineNumberAreaWidth(), 0); }
-
-protected:
-    void paintEvent(QPaintEvent *event) override { m_editor->lineNumberAreaPaintEvent(event); }
-
-private:
-    AsmEditor *m_editor;
-};
-
 class MainWindow : public QMainWindow
 {
     Q_OBJECT
 
 public:
     MainWindow(QWidget *parent = nullptr);
-    ~MainWindow() = default;
+    ~MainWindow() override;
 
 private slots:
     void openBinary();
@@ -78,20 +78,32 @@ private slots:
     void extractStrings(); // New: Strings Extraction / 새 기능: 문자열 추출
     void runPythonRev();   // New: Python Reversing / 새 기능: 파이썬 리버싱
     void runInterpretedRev(); // New: Interpreted Reversing / 새 기능: 인터프리터 리버싱
-    void procFinished(int exitCode, QProcess::ExitStatus status);
-    void readProcOutput();
-    void readProcError();
+    void goToLocation();   // New: Jump to address/symbol / 새 기능: 주소/심볼로 이동
+    void updateProgress();
     void closeTab(int index);
     void checkDashboard();
 
 private:
+    static constexpr int kLargeTextChars = 1000000; // Text tabs above this use ListingView / 이보다 큰 텍스트 탭은 ListingView 사용
+
     void setupToolbar();
     void setupStatusBar();
-    void addEditorTab(const QString &title, const QString &content, bool isViz = false);
-    void loadLargeText(AsmEditor *ed, const QString &content);
+    // Streaming tabs (empty content) and large text get a ListingView / 스트리밍 탭과 큰 텍스트는 ListingView 사용
+    void addEditorTab(const QString &title, const QString &content, bool isViz = false, bool activate = true);
     QString detectArch(const QString &path);
-    void appendToCurrentTab(const QString &text);
     void startDisassembly(const QString &file, const QString &arch);
+    void sessionFinished(DisassemblySession *session);
+    // Graph work for a finished listing, run on the thread pool / 완료된 목록의 그래프 작업, 스레드 풀에서 실행
+    struct GraphJob {
+        QPointer<ListingView> source;
+        QPointer<QWidget> mapTab; // Placeholder until the graph arrives / 그래프 도착 전 자리 표시 탭
+        QString file;
+        std::shared_ptr<std::atomic<bool>> cancel;
+    };
+    void startGraph(DisassemblySession *session, ListingView *view);
+    void graphFinished(const std::shared_ptr<std::atomic<bool>> &cancel, const QByteArray &mermaid, const QString &status);
+    void cancelGraph(int index); // Also closes the placeholder / 자리 표시 탭도 닫음
+    void fillMapTab(QWidget *placeholder, const QByteArray &mermaid);
     void updateUiText(); // Helper to refresh KR/EN labels / KR/EN 레이블 새로고침 헬퍼
     void applyTheme();   // New: Apply CSS theme
 
@@ -105,13 +117,18 @@ private:
     QAction *m_pythonAct;
     QAction *m_interpretedAct;
     QAction *m_themeAct;
+    QAction *m_gotoAct;
     QProgressBar *m_progressBar;
+    QLabel *m_jobsLabel; // Every queued and running job / 대기 및 실행 중인 모든 작업
+    QTimer m_progressTimer; // Polls the sessions at the view's frame rate / 뷰 프레임 주기로 세션 확인
     QString m_lastStatusMsg; // Persistence for status / 상태 유지를 위한 메시지
-    QProcess *m_proc;
     QString m_currentAsmPath;
     DashboardWidget *m_dashboard;
-    long long m_totalExpectedSize;
-    long long m_processedSize;
+    int m_jobs; // Parallel objdump workers per disassembly / 역어셈블당 병렬 objdump 작업자 수
+    JobManager *m_jobManager; // Disassemblies running at once, capped by "maxJobs" / 동시 역어셈블, "maxJobs"로 제한
+    QList<GraphJob> m_graphJobs;
+    QList<QThread *> m_stringsWorkers; // Joined by the destructor / 소멸자에서 대기
+    ResultCache m_cache; // ~/.cache/thedecoder, shared with the CLI / CLI와 공유
     bool m_isReadOnly; // New state variable
     bool m_isDarkMode; // New state variable
 
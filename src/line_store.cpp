@@ -0,0 +1,112 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Line Store Implementation - Temporary backing file, checkpoints and remapping
+ */
+#include "line_store.h"
+#include <algorithm>
+#include <cstdlib>
+#include <sys/mman.h>
+
+namespace {
+constexpr size_t kCopyChunk = 1 << 20;
+
+// Disk-backed by default; /tmp is often tmpfs, which would hold the listing in RAM
+// 기본값은 디스크 기반, /tmp는 흔히 tmpfs라 목록이 RAM에 남음
+std::string temporaryDirectory() {
+    const char* dir = getenv("TMPDIR");
+    return dir && *dir ? dir : "/var/tmp";
+}
+
+bool writeAll(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = ::write(fd, data, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+}
+
+LineStore::LineStore() : m_checkpoints{0} {
+    for (const std::string& dir : {temporaryDirectory(), std::string("/tmp")}) {
+        std::string path = dir + "/thedecoder-view-XXXXXX";
+        m_fd = mkostemp(&path[0], O_CLOEXEC);
+        if (m_fd < 0) continue;
+        unlink(path.c_str()); // Gone with the last descriptor / 마지막 디스크립터와 함께 삭제
+        break;
+    }
+    m_failed = m_fd < 0;
+}
+
+LineStore::~LineStore() {
+    if (m_map) munmap(const_cast<char*>(m_map), m_mapSize);
+    if (m_fd >= 0) ::close(m_fd);
+}
+
+void LineStore::write(const char* data, size_t len) {
+    if (m_failed || len == 0) return;
+    // Index only what reached the file, so lines never point past its end
+    // 파일에 기록된 것만 색인하여 행이 파일 끝을 넘지 않도록 함
+    if (!writeAll(m_fd, data, len)) {
+        m_failed = true;
+        return;
+    }
+    const char* p = data;
+    const char* end = data + len;
+    while (const char* nl = static_cast<const char*>(memchr(p, '\n', end - p))) {
+        uint64_t next = m_size + static_cast<uint64_t>(nl - data) + 1;
+        m_longest = std::max<size_t>(m_longest, next - 1 - m_lastLineStart);
+        m_lastLineStart = next;
+        if (++m_newlines % kStride == 0) m_checkpoints.push_back(next);
+        p = nl + 1;
+    }
+    m_size += len;
+    m_longest = std::max<size_t>(m_longest, m_size - m_lastLineStart);
+}
+
+bool LineStore::ensureMapped(uint64_t end) const {
+    if (end <= m_mapSize) return true;
+    // Mapping past EOF is allowed; only pages up to m_size are ever touched
+    // EOF 이후 매핑은 허용되며 m_size까지의 페이지만 접근함
+    uint64_t size = (end + kMapGranule - 1) / kMapGranule * kMapGranule;
+    void* p = mmap(nullptr, size, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (p == MAP_FAILED) return false;
+    if (m_map) munmap(const_cast<char*>(m_map), m_mapSize);
+    m_map = static_cast<const char*>(p);
+    m_mapSize = size;
+    return true;
+}
+
+std::string_view LineStore::line(size_t n) const {
+    if (n >= lineCount() || !ensureMapped(m_size)) return std::string_view();
+    const char* end = m_map + m_size;
+    const char* p = m_map + m_checkpoints[n / kStride];
+    for (size_t skip = n % kStride; skip > 0; --skip) {
+        p = static_cast<const char*>(memchr(p, '\n', end - p)) + 1;
+    }
+    const char* nl = static_cast<const char*>(memchr(p, '\n', end - p));
+    return std::string_view(p, (nl ? nl : end) - p);
+}
+
+bool LineStore::saveTo(const std::string& path) const {
+    if (m_fd < 0) return false;
+    int out = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (out < 0) return false;
+    loff_t offset = 0;
+    while (static_cast<uint64_t>(offset) < m_size) {
+        ssize_t n = copy_file_range(m_fd, &offset, out, nullptr, m_size - offset, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+    }
+    // Cross-filesystem targets fall back to copying from the mapping / 파일 시스템 간 대상은 매핑에서 복사
+    bool ok = true;
+    if (static_cast<uint64_t>(offset) < m_size) {
+        ok = ensureMapped(m_size);
+        for (uint64_t at = offset; ok && at < m_size; at += kCopyChunk) {
+            ok = writeAll(out, m_map + at, static_cast<size_t>(std::min<uint64_t>(kCopyChunk, m_size - at)));
+        }
+    }
+    return ::close(out) == 0 && ok;
+}
@@ -0,0 +1,64 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Line Store Header - Append-only, memory-mapped text with a sparse line index
+ */
+#ifndef LINE_STORE_H
+#define LINE_STORE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "stream_sink.h"
+
+/**
+ * @brief Backing store for views that show listings of any size / 크기에 상관없이 목록을 보여주는 뷰의 저장소
+ *
+ * Text is appended to an unlinked temporary file and read back through a shared mapping,
+ * so memory stays bounded by what is on screen. Only every kStride-th line start is
+ * indexed; a line is found by scanning at most kStride - 1 newlines from its checkpoint.
+ * 텍스트는 unlink된 임시 파일에 추가되고 공유 매핑으로 읽으므로 메모리는 화면에 보이는 양으로 제한됩니다.
+ * kStride 번째 행의 시작만 색인하며, 행은 체크포인트에서 최대 kStride - 1개의 개행을 건너 찾습니다.
+ */
+class LineStore : public OutputSink {
+public:
+    static constexpr size_t kStride = 64;
+    static constexpr uint64_t kMapGranule = 256ULL << 20; // Remap at most once per 256 MiB / 256 MiB마다 최대 한 번 재매핑
+
+    LineStore();
+    ~LineStore() override;
+
+    LineStore(const LineStore&) = delete;
+    LineStore& operator=(const LineStore&) = delete;
+
+    bool isOpen() const { return m_fd >= 0; }
+    bool good() const { return !m_failed; }
+
+    void write(const char* data, size_t len) override;
+
+    uint64_t size() const { return m_size; }
+    // A trailing line without a newline counts / 개행 없는 마지막 행도 포함
+    size_t lineCount() const { return m_newlines + (m_size > m_lastLineStart ? 1 : 0); }
+    size_t longestLine() const { return m_longest; } // In bytes / 바이트 단위
+
+    // Line n without its newline; valid until the next call on the store / 개행 제외, 다음 호출까지 유효
+    std::string_view line(size_t n) const;
+
+    // Copies the whole text to path, in the kernel where possible / 가능하면 커널 안에서 전체 복사
+    bool saveTo(const std::string& path) const;
+
+private:
+    bool ensureMapped(uint64_t end) const;
+
+    int m_fd = -1;
+    bool m_failed = false;
+    uint64_t m_size = 0;
+    size_t m_newlines = 0;
+    uint64_t m_lastLineStart = 0;
+    size_t m_longest = 0;
+    std::vector<uint64_t> m_checkpoints; // Start of line k * kStride / k * kStride 번째 행의 시작
+    mutable const char* m_map = nullptr;
+    mutable uint64_t m_mapSize = 0;
+};
+
+#endif
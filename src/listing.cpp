@@ -0,0 +1,353 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Listing Model Implementation - Single-pass objdump line parser
+ */
+#include "listing.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+inline int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Parses a hex run starting at i; returns its end / i부터 16진수를 파싱하여 끝 위치 반환
+inline size_t scanHex(std::string_view s, size_t i, uint64_t& value) {
+    value = 0;
+    while (i < s.size()) {
+        int v = hexValue(s[i]);
+        if (v < 0) break;
+        value = (value << 4) | static_cast<uint64_t>(v);
+        ++i;
+    }
+    return i;
+}
+
+inline bool isPrefix(std::string_view w) {
+    static const char* const prefixes[] = {
+        "rep", "repz", "repnz", "repe", "repne", "lock", "notrack", "bnd",
+        "data16", "addr32", "cs", "ds", "es", "fs", "gs", "ss"
+    };
+    for (const char* p : prefixes) {
+        if (w == p) return true;
+    }
+    return false;
+}
+
+// ARM condition suffixes; "al" is never printed / ARM 조건 접미사, "al"은 출력되지 않음
+inline bool isArmCondition(std::string_view c) {
+    static const char* const conditions[] = {
+        "eq", "ne", "cs", "hs", "cc", "lo", "mi", "pl", "vs", "vc", "hi", "ls", "ge", "lt", "gt", "le"
+    };
+    for (const char* p : conditions) {
+        if (c == p) return true;
+    }
+    return false;
+}
+
+// MIPS compare-and-branch forms after the leading 'b' / 앞의 'b' 뒤에 오는 MIPS 비교 분기 형식
+inline bool isMipsCondition(std::string_view c) {
+    static const char* const conditions[] = {"eqz", "nez", "gez", "gtz", "lez", "ltz"};
+    for (const char* p : conditions) {
+        if (c == p) return true;
+    }
+    return false;
+}
+
+inline bool isReturnRegister(std::string_view r) { return r == "lr" || r == "ra" || r == "$ra" || r == "$31"; }
+
+// ops is the operand text, used where the register decides between a jump and a return
+// ops는 피연산자 텍스트이며, 레지스터에 따라 점프와 반환이 갈리는 경우에 사용
+uint8_t classify(std::string_view m, std::string_view ops) {
+    auto starts = [&](std::string_view p) { return m.substr(0, p.size()) == p; };
+    // Thumb width qualifiers: "b.n", "bne.w" / Thumb 폭 한정자
+    if (m.size() > 2 && m[m.size() - 2] == '.' && (m.back() == 'n' || m.back() == 'w')) m.remove_suffix(2);
+
+    if (starts("call") || m == "bl" || m == "blx" || m == "blr" || m == "jal" || m == "jalr" || m == "jalr.hb" ||
+        m == "jalrc" || m == "jialc" || m == "bal" || m == "bgezal" || m == "bltzal") return Listing::Call;
+    if (starts("ret") || m == "iret" || m == "iretq" || m == "eret") return Listing::Return;
+    // MIPS "jr ra" and ARM "bx lr" return; x86 "jrcxz" is a conditional jump / x86 "jrcxz"는 조건 분기
+    if (m == "jr" || m == "jr.hb" || m == "jrc" || m == "bx") {
+        return isReturnRegister(ops) ? Listing::Return : Listing::Jump;
+    }
+    if (starts("jmp") || m == "b" || m == "br" || m == "j" || m == "jic") return Listing::Jump;
+    if ((m.size() > 1 && m[0] == 'j') || starts("loop") || starts("b.") ||
+        m == "cbz" || m == "cbnz" || m == "tbz" || m == "tbnz") return Listing::CondJump;
+    // ARM b<cc>, bl<cc>, blx<cc>, bx<cc>; MIPS beq, bne, bgez, ... / ARM 조건부 분기와 MIPS 비교 분기
+    if (m.size() >= 3 && m[0] == 'b') {
+        std::string_view rest = m.substr(1);
+        if (isArmCondition(rest) || isMipsCondition(rest)) return Listing::CondJump;
+        if (rest.size() == 3 && rest[0] == 'l' && isArmCondition(rest.substr(1))) return Listing::Call;
+        if (rest.size() == 4 && rest.substr(0, 2) == "lx" && isArmCondition(rest.substr(2))) return Listing::Call;
+        if (rest.size() == 3 && rest[0] == 'x' && isArmCondition(rest.substr(1))) return Listing::CondJump;
+    }
+    return 0;
+}
+
+// Leading "0x" is optional / 앞의 "0x"는 선택 사항
+inline size_t scanHexLiteral(std::string_view s, size_t i, uint64_t& value) {
+    if (i + 1 < s.size() && s[i] == '0' && (s[i + 1] == 'x' || s[i + 1] == 'X')) {
+        size_t end = scanHex(s, i + 2, value);
+        return end == i + 2 ? i : end;
+    }
+    return scanHex(s, i, value);
+}
+
+// First absolute literal in the operands: "$0x402004", "0x601040,%eax", "edi,0x402004", "[0x601040]"
+// Displacements such as "0x10(%rbp)" or "[rbp-0x10]" are skipped.
+// 피연산자의 첫 절대 리터럴. "0x10(%rbp)", "[rbp-0x10]" 같은 변위는 제외
+inline bool scanOperandLiteral(std::string_view ops, uint64_t& value) {
+    for (size_t k = 0; k + 2 < ops.size(); ++k) {
+        if (ops[k] != '0' || ops[k + 1] != 'x') continue;
+        char before = k == 0 ? ' ' : ops[k - 1];
+        if (before != '$' && before != ',' && before != ' ' && before != '[' && before != ':') continue;
+        size_t end = scanHex(ops, k + 2, value);
+        if (end == k + 2) continue;
+        if (end == ops.size() || ops[end] == ',' || ops[end] == ']' || ops[end] == ' ') return true;
+        k = end;
+    }
+    return false;
+}
+
+inline uint16_t clampSpan(size_t v) { return v >= Listing::noSpan ? Listing::noSpan - 1 : static_cast<uint16_t>(v); }
+}
+
+Listing::Fields Listing::parseLine(std::string_view line) {
+    Fields f;
+    size_t n = line.size();
+    if (n == 0) return f;
+
+    // "Disassembly of section .text:"
+    static constexpr std::string_view kSection = "Disassembly of section ";
+    if (line.substr(0, kSection.size()) == kSection && line.back() == ':') {
+        f.kind = Kind::Section;
+        f.name = line.substr(kSection.size(), n - kSection.size() - 1);
+        return f;
+    }
+
+    // "0000000000001000 <main>:"
+    if (hexValue(line[0]) >= 0) {
+        uint64_t addr;
+        size_t i = scanHex(line, 0, addr);
+        if (i + 2 < n && line[i] == ' ' && line[i + 1] == '<' && n >= i + 4 &&
+            line[n - 2] == '>' && line[n - 1] == ':') {
+            f.kind = Kind::Function;
+            f.address = addr;
+            f.name = line.substr(i + 2, n - i - 4);
+        }
+        return f;
+    }
+
+    // "    1000:\t55                   \tpush   %rbp"
+    size_t i = 0;
+    while (i < n && line[i] == ' ') ++i;
+    uint64_t addr;
+    size_t j = scanHex(line, i, addr);
+    if (j == i || j + 1 >= n || line[j] != ':' || line[j + 1] != '\t') return f;
+
+    f.address = addr;
+    size_t bytes = j + 2;
+    size_t tab = line.find('\t', bytes);
+    size_t bytesEnd = tab == std::string_view::npos ? n : tab;
+    size_t trimmed = bytesEnd;
+    while (trimmed > bytes && line[trimmed - 1] == ' ') --trimmed;
+    f.bytesOff = clampSpan(bytes);
+    f.bytesLen = clampSpan(trimmed - bytes);
+
+    size_t as = tab == std::string_view::npos ? n : tab + 1;
+    if (as >= n) {
+        f.kind = Kind::Bytes;
+        return f;
+    }
+    f.kind = Kind::Instruction;
+
+    // Mnemonic, skipping prefixes such as "rep" or "notrack" / 접두사를 건너뛴 니모닉
+    // x86 pads the operands with spaces, ARM and MIPS with a tab / x86은 공백, ARM과 MIPS는 탭으로 구분
+    size_t m = as;
+    size_t mEnd = line.find_first_of(" \t", m);
+    if (mEnd == std::string_view::npos) mEnd = n;
+    while (mEnd < n && isPrefix(line.substr(m, mEnd - m))) {
+        size_t next = mEnd;
+        while (next < n && line[next] == ' ') ++next;
+        if (next >= n) break;
+        size_t nextEnd = line.find_first_of(" \t", next);
+        if (nextEnd == std::string_view::npos) nextEnd = n;
+        m = next;
+        mEnd = nextEnd;
+    }
+    f.mnemonicOff = clampSpan(m);
+    f.mnemonicLen = clampSpan(mEnd - m);
+
+    // Trailing comment: x86 "  # ...", ARM "\t@ ..." / "\t; ...", AArch64 "\t// ..."
+    size_t comment = n;
+    for (size_t k = mEnd; k < n; ++k) {
+        char c = line[k];
+        if ((c == '#' && k >= 2 && line[k - 1] == ' ' && line[k - 2] == ' ') ||
+            ((c == '@' || c == ';') && line[k - 1] == '\t') ||
+            (c == '/' && k + 1 < n && line[k + 1] == '/' && line[k - 1] == '\t')) {
+            comment = k;
+            break;
+        }
+    }
+    if (comment < n) f.commentOff = clampSpan(comment);
+
+    size_t op = mEnd;
+    while (op < comment && (line[op] == ' ' || line[op] == '\t')) ++op;
+    size_t opEnd = comment;
+    while (opEnd > op && (line[opEnd - 1] == ' ' || line[opEnd - 1] == '\t')) --opEnd;
+    if (opEnd > op) {
+        f.operandOff = clampSpan(op);
+        f.operandLen = clampSpan(opEnd - op);
+    }
+    f.flags = classify(line.substr(m, mEnd - m), line.substr(op, opEnd - op));
+
+    // Data reference: objdump resolves RIP/PC-relative operands in the comment
+    // ("# 4dff0 <sym>", "@ 0x1234"); otherwise take an absolute operand literal
+    // 데이터 참조: objdump가 주석에 RIP/PC 상대 주소를 풀어 주며, 없으면 절대 피연산자 리터럴 사용
+    if (comment < n) {
+        size_t c = comment + (line[comment] == '/' ? 2 : 1);
+        while (c < n && line[c] == ' ') ++c;
+        size_t end = scanHexLiteral(line, c, f.reference);
+        f.hasReference = end > c && (end == n || line[end] == ' ');
+    }
+    if (!f.hasReference && opEnd > op) {
+        f.hasReference = scanOperandLiteral(line.substr(op, opEnd - op), f.reference);
+    }
+    if (!f.hasReference) f.reference = 0;
+
+    // Symbol reference "1027 <main+0x27>" / 심볼 참조
+    size_t lt = line.find('<', mEnd);
+    if (lt != std::string_view::npos) {
+        size_t gt = line.find('>', lt);
+        if (gt != std::string_view::npos) {
+            std::string_view sym = line.substr(lt + 1, gt - lt - 1);
+            size_t plus = sym.find("+0x");
+            if (plus != std::string_view::npos) sym = sym.substr(0, plus);
+            f.symbol = sym;
+
+            size_t h = lt;
+            if (h > 0 && line[h - 1] == ' ') --h;
+            size_t hs = h;
+            while (hs > 0 && hexValue(line[hs - 1]) >= 0) --hs;
+            if (hs < h && (hs == 0 || line[hs - 1] == ' ' || line[hs - 1] == ',' || line[hs - 1] == '\t')) {
+                scanHex(line, hs, f.target);
+                f.hasTarget = true;
+            }
+        }
+    }
+    return f;
+}
+
+void Listing::append(std::string_view line, const Fields& f) {
+    uint64_t addr = f.address;
+    if (f.kind == Kind::Other || f.kind == Kind::Section) {
+        addr = m_address.empty() ? 0 : m_address.back(); // Keep the column sorted / 열 정렬 유지
+    }
+
+    uint32_t symbol = npos;
+    uint16_t mnemonic = 0;
+    switch (f.kind) {
+        case Kind::Section:
+            m_sectionNames.emplace_back(f.name);
+            m_currentSection = static_cast<uint16_t>(m_sectionNames.size() - 1);
+            break;
+        case Kind::Function:
+            symbol = m_symbols.intern(f.name);
+            m_currentFunction = static_cast<uint32_t>(m_functionSymbol.size());
+            m_functionSymbol.push_back(symbol);
+            m_functionRow.push_back(static_cast<uint32_t>(m_kind.size()));
+            break;
+        case Kind::Instruction:
+            mnemonic = internMnemonic(line.substr(f.mnemonicOff, f.mnemonicLen), f.flags);
+            if (!f.symbol.empty()) symbol = m_symbols.intern(f.symbol);
+            break;
+        default:
+            break;
+    }
+
+    if (!m_address.empty() && addr < m_address.back()) m_sorted = false;
+    m_kind.push_back(static_cast<uint8_t>(f.kind));
+    m_address.push_back(addr);
+    m_target.push_back(f.hasTarget ? f.target : 0);
+    m_lineLength.push_back(static_cast<uint32_t>(line.size()));
+    m_bytesOff.push_back(f.bytesOff);
+    m_bytesLen.push_back(f.bytesLen);
+    m_mnemonicOff.push_back(f.mnemonicOff);
+    m_mnemonic.push_back(mnemonic);
+    m_operandOff.push_back(f.operandOff);
+    m_operandLen.push_back(f.operandLen);
+    m_commentOff.push_back(f.commentOff);
+    m_symbol.push_back(symbol);
+    m_function.push_back(m_currentFunction);
+    m_section.push_back(m_currentSection);
+}
+
+void Listing::clear() {
+    *this = Listing();
+}
+
+uint16_t Listing::internMnemonic(std::string_view m, uint8_t flags) {
+    if (m_mnemonics.size() == 0) {
+        // Id 0 is reserved for "no mnemonic" / 0번은 "니모닉 없음"으로 예약
+        m_mnemonics.intern(std::string_view());
+        m_mnemonicFlags.push_back(0);
+    }
+    uint32_t known = m_mnemonics.find(m);
+    if (known != SymbolTable::npos) return static_cast<uint16_t>(known);
+    if (m_mnemonics.size() >= noSpan) return 0;
+    m_mnemonicFlags.push_back(flags);
+    return static_cast<uint16_t>(m_mnemonics.intern(m));
+}
+
+size_t Listing::rowOfAddress(uint64_t addr) const {
+    auto matches = [&](size_t r) {
+        Kind k = kind(r);
+        return m_address[r] == addr && (k == Kind::Instruction || k == Kind::Function);
+    };
+    // Linked images are address-sorted; relocatable objects restart at 0 per section
+    // 링크된 이미지는 주소순이며, 재배치 객체는 섹션마다 0부터 다시 시작합니다
+    if (m_sorted) {
+        size_t r = std::lower_bound(m_address.begin(), m_address.end(), addr) - m_address.begin();
+        for (; r < size() && m_address[r] == addr; ++r) {
+            if (matches(r)) return r;
+        }
+        return npos;
+    }
+    for (size_t r = 0; r < size(); ++r) {
+        if (matches(r)) return r;
+    }
+    return npos;
+}
+
+std::vector<size_t> Listing::rowsReferencing(uint32_t symbolId) const {
+    std::vector<size_t> rows;
+    if (symbolId == npos) return rows;
+    for (size_t r = 0; r < size(); ++r) {
+        if (m_symbol[r] == symbolId && kind(r) == Kind::Instruction) rows.push_back(r);
+    }
+    return rows;
+}
+
+void Listing::exportTsv(std::ostream& out) const {
+    out << "address\tsection\tfunction\tmnemonic\ttarget\tsymbol\n";
+    char buf[24];
+    for (size_t r = 0; r < size(); ++r) {
+        if (kind(r) != Kind::Instruction) continue;
+        snprintf(buf, sizeof(buf), "%llx", static_cast<unsigned long long>(m_address[r]));
+        out << buf << '\t';
+        if (m_section[r] != noSpan) out << m_sectionNames[m_section[r]];
+        out << '\t';
+        if (m_function[r] != npos) out << m_symbols.name(m_functionSymbol[m_function[r]]);
+        out << '\t' << m_mnemonics.name(m_mnemonic[r]) << '\t';
+        if (m_target[r]) {
+            snprintf(buf, sizeof(buf), "%llx", static_cast<unsigned long long>(m_target[r]));
+            out << buf;
+        }
+        out << '\t';
+        if (m_symbol[r] != npos) out << m_symbols.name(m_symbol[r]);
+        out << '\n';
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Listing Model Header - objdump lines parsed once into struct-of-arrays records
+ */
+#ifndef LISTING_H
+#define LISTING_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+#include "symbol_table.h"
+
+/**
+ * @brief Compact record store shared by the CFG builder, highlighter, search and export
+ * CFG 빌더, 하이라이터, 검색, 내보내기가 공유하는 압축 레코드 저장소
+ *
+ * Each objdump line becomes one row; columns are stored as parallel arrays so
+ * consumers that scan one field (addresses, mnemonics, targets) stay cache friendly.
+ * Spans are byte offsets relative to the start of the line.
+ * objdump의 각 행은 하나의 레코드가 되며, 열은 병렬 배열로 저장됩니다.
+ */
+class Listing {
+public:
+    static constexpr uint32_t npos = 0xffffffffu;
+    static constexpr uint16_t noSpan = 0xffff;
+
+    enum class Kind : uint8_t {
+        Other,       // Blank, file header, "..." / 빈 행, 파일 헤더 등
+        Section,     // "Disassembly of section .text:"
+        Function,    // "0000000000001000 <main>:"
+        Instruction, // "    1000:\t55 \tpush %rbp"
+        Bytes        // Continuation line holding only raw bytes / 바이트만 있는 연속 행
+    };
+
+    // Mnemonic classification bits / 니모닉 분류 비트
+    enum MnemonicFlags : uint8_t {
+        Call = 1,
+        Jump = 2,        // Unconditional jump / 무조건 점프
+        CondJump = 4,    // Conditional branch / 조건 분기
+        Return = 8
+    };
+
+    // One parsed line before it is stored / 저장 전 파싱된 한 행
+    struct Fields {
+        Kind kind = Kind::Other;
+        uint64_t address = 0;
+        uint64_t target = 0;       // Address preceding "<sym>" / "<sym>" 앞의 주소
+        bool hasTarget = false;
+        uint64_t reference = 0;    // Resolved comment address or absolute operand / 주석의 해석된 주소 또는 절대 피연산자
+        bool hasReference = false;
+        uint16_t bytesOff = noSpan, bytesLen = 0;
+        uint16_t mnemonicOff = noSpan, mnemonicLen = 0;
+        uint16_t operandOff = noSpan, operandLen = 0;
+        uint16_t commentOff = noSpan;
+        uint8_t flags = 0;         // MnemonicFlags of the instruction / 명령어의 MnemonicFlags
+        std::string_view name;     // Function / section name / 함수, 섹션 이름
+        std::string_view symbol;   // Referenced symbol without "+0x.." / 참조 심볼
+    };
+
+    /**
+     * Parses one objdump line (without newline) into fields. No allocation, no regex.
+     * objdump 한 행을 필드로 파싱합니다. 할당과 정규식을 사용하지 않습니다.
+     */
+    static Fields parseLine(std::string_view line);
+
+    void feedLine(std::string_view line) { append(line, parseLine(line)); }
+    // Stores an already parsed line / 이미 파싱된 행 저장
+    void append(std::string_view line, const Fields& f);
+    void clear();
+
+    size_t size() const { return m_kind.size(); }
+    Kind kind(size_t row) const { return static_cast<Kind>(m_kind[row]); }
+    uint64_t address(size_t row) const { return m_address[row]; }
+    uint64_t target(size_t row) const { return m_target[row]; }
+    uint32_t lineLength(size_t row) const { return m_lineLength[row]; }
+    uint16_t bytesOffset(size_t row) const { return m_bytesOff[row]; }
+    uint16_t bytesLength(size_t row) const { return m_bytesLen[row]; }
+    uint16_t mnemonicOffset(size_t row) const { return m_mnemonicOff[row]; }
+    uint16_t operandOffset(size_t row) const { return m_operandOff[row]; }
+    uint16_t operandLength(size_t row) const { return m_operandLen[row]; }
+    uint16_t commentOffset(size_t row) const { return m_commentOff[row]; }
+    uint16_t mnemonicId(size_t row) const { return m_mnemonic[row]; }
+    uint32_t symbolRef(size_t row) const { return m_symbol[row]; }
+    uint32_t functionOf(size_t row) const { return m_function[row]; }
+    uint16_t sectionOf(size_t row) const { return m_section[row]; }
+
+    std::string_view mnemonicName(uint16_t id) const { return m_mnemonics.name(id); }
+    uint8_t mnemonicFlags(uint16_t id) const { return m_mnemonicFlags[id]; }
+    size_t mnemonicLength(size_t row) const { return m_mnemonics.name(m_mnemonic[row]).size(); }
+
+    std::string_view symbolName(uint32_t id) const { return m_symbols.name(id); }
+    uint32_t findSymbol(std::string_view name) const { return m_symbols.find(name); }
+
+    size_t functionCount() const { return m_functionSymbol.size(); }
+    uint32_t functionSymbol(uint32_t fn) const { return m_functionSymbol[fn]; }
+    uint32_t functionRow(uint32_t fn) const { return m_functionRow[fn]; }
+    const std::string& sectionName(uint16_t id) const { return m_sectionNames[id]; }
+
+    // Search / 검색
+    size_t rowOfAddress(uint64_t addr) const;
+    std::vector<size_t> rowsReferencing(uint32_t symbolId) const;
+
+    // Export: one tab-separated record per instruction / 내보내기: 명령어당 탭 구분 레코드
+    void exportTsv(std::ostream& out) const;
+
+private:
+    uint16_t internMnemonic(std::string_view m, uint8_t flags);
+
+    // Columns / 열
+    std::vector<uint8_t> m_kind;
+    std::vector<uint64_t> m_address;
+    std::vector<uint64_t> m_target;
+    std::vector<uint32_t> m_lineLength;
+    std::vector<uint16_t> m_bytesOff, m_bytesLen;
+    std::vector<uint16_t> m_mnemonicOff, m_mnemonic;
+    std::vector<uint16_t> m_operandOff, m_operandLen;
+    std::vector<uint16_t> m_commentOff;
+    std::vector<uint32_t> m_symbol;
+    std::vector<uint32_t> m_function;
+    std::vector<uint16_t> m_section;
+
+    // Side tables / 보조 테이블
+    SymbolTable m_mnemonics;
+    std::vector<uint8_t> m_mnemonicFlags;
+    SymbolTable m_symbols;
+    std::vector<uint32_t> m_functionSymbol;
+    std::vector<uint32_t> m_functionRow;
+    std::vector<std::string> m_sectionNames;
+
+    uint32_t m_currentFunction = npos;
+    uint16_t m_currentSection = noSpan;
+    bool m_sorted = true; // m_address never decreased so far / 지금까지 m_address가 감소하지 않음
+};
+
+#endif
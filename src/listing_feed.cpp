@@ -0,0 +1,98 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Listing Feed Implementation - Ring draining, batching and throughput counting
+ */
+#include "listing_feed.h"
+#include <vector>
+
+namespace {
+long long nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+}
+
+ListingFeed::ListingFeed(bool records)
+    : m_recordFeed([this](std::string_view line) {
+          // Parsed once for both consumers / 두 소비자를 위해 한 번만 파싱
+          Listing::Fields fields = Listing::parseLine(line);
+          m_graph.addRecord(fields);
+          m_listing.append(line, fields);
+      }),
+      m_records(records),
+      m_thread([this]() { run(); }) {}
+
+ListingFeed::~ListingFeed() {
+    m_ring.close();
+    if (m_thread.joinable()) m_thread.join();
+}
+
+void ListingFeed::write(const char* data, size_t len) {
+    if (len == 0) return;
+    long long unset = 0;
+    m_startNs.compare_exchange_strong(unset, nowNs());
+    // Line-sized producers would otherwise wake the ingest thread once per line
+    // 그렇지 않으면 행 단위 생산자가 행마다 수집 스레드를 깨움
+    if (m_pending.empty() && len >= kCoalesceBytes) {
+        m_ring.write(data, len);
+        return;
+    }
+    m_pending.append(data, len);
+    if (m_pending.size() >= kCoalesceBytes) flush();
+}
+
+void ListingFeed::flush() {
+    if (m_pending.empty()) return;
+    m_ring.write(m_pending.data(), m_pending.size());
+    m_pending.clear();
+}
+
+void ListingFeed::run() {
+    std::vector<char> batch(kBatchBytes);
+    while (size_t n = m_ring.read(batch.data(), batch.size())) {
+        {
+            std::lock_guard<std::mutex> guard(m_storeLock);
+            m_store.write(batch.data(), n);
+            m_longest.store(m_store.longestLine(), std::memory_order_relaxed);
+            m_lines.store(m_store.lineCount(), std::memory_order_release);
+        }
+        if (m_records) {
+            std::lock_guard<std::mutex> guard(m_recordLock);
+            m_recordFeed.write(batch.data(), n);
+        }
+        m_bytes += static_cast<long long>(n);
+        m_endNs = nowNs();
+    }
+}
+
+void ListingFeed::finish() {
+    if (m_finished) return;
+    flush();
+    m_ring.close();
+    if (m_thread.joinable()) m_thread.join();
+    if (m_records) {
+        std::lock_guard<std::mutex> guard(m_recordLock);
+        m_recordFeed.flush();
+        m_graph.finalize();
+    }
+    m_finished = true;
+}
+
+std::string ListingFeed::line(size_t n) const {
+    // Copied out, since a later call may remap the store / 이후 호출이 재매핑할 수 있으므로 복사
+    std::lock_guard<std::mutex> guard(m_storeLock);
+    return std::string(m_store.line(n));
+}
+
+bool ListingFeed::saveTo(const std::string& path) const {
+    std::lock_guard<std::mutex> guard(m_storeLock);
+    return m_store.saveTo(path);
+}
+
+ListingFeed::Throughput ListingFeed::throughput() const {
+    Throughput t;
+    t.bytes = m_bytes.load();
+    long long start = m_startNs.load();
+    if (start > 0 && t.bytes > 0) t.seconds = (m_endNs.load() - start) / 1e9;
+    return t;
+}
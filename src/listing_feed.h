@@ -0,0 +1,99 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Listing Feed Header - Off-thread indexing and parsing of streamed listings
+ */
+#ifndef LISTING_FEED_H
+#define LISTING_FEED_H
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "byte_ring.h"
+#include "line_store.h"
+#include "listing.h"
+#include "control_flow.h"
+#include "stream_sink.h"
+
+/**
+ * @brief Moves a streamed listing into a LineStore and records on its own thread
+ * 스트리밍 목록을 별도 스레드에서 LineStore와 레코드로 옮김
+ *
+ * The producer only copies into a ring; an ingest thread drains it in large batches and
+ * appends them to the store. Feeds built with records also parse every line once for search
+ * and the graph; other text only costs the store. Viewers poll lineCount() at their own frame
+ * rate instead of reacting to each chunk.
+ * 생산자는 링에 복사만 하고, 수집 스레드가 큰 묶음으로 꺼내 저장소에 추가합니다. 레코드를 켠 피드는
+ * 검색과 그래프를 위해 각 행을 한 번 파싱하며, 그 외 텍스트는 저장소 비용만 듭니다.
+ * 뷰는 청크마다 반응하지 않고 자체 프레임 주기로 lineCount()를 확인합니다.
+ */
+class ListingFeed : public OutputSink {
+public:
+    static constexpr size_t kRingBytes = 8 << 20;
+    static constexpr size_t kBatchBytes = 1 << 20; // Bounds how long the store lock is held / 저장소 잠금 시간 제한
+    static constexpr size_t kCoalesceBytes = 64 << 10; // Smaller writes are gathered first / 이보다 작은 쓰기는 모아서 전달
+
+    // Bytes ingested and time since the first one / 수집된 바이트와 첫 바이트 이후 시간
+    struct Throughput {
+        long long bytes = 0;
+        double seconds = 0;
+        double mbps() const { return seconds > 0 ? bytes / seconds / (1024.0 * 1024.0) : 0.0; }
+    };
+
+    // records: parse lines into listing() and graph(), for disassembly / 역어셈블용으로 행을 listing()과 graph()로 파싱
+    explicit ListingFeed(bool records = false);
+    ~ListingFeed() override;
+
+    ListingFeed(const ListingFeed&) = delete;
+    ListingFeed& operator=(const ListingFeed&) = delete;
+
+    // One producer at a time, any thread; blocks while the ring is full
+    // 한 번에 한 생산자, 모든 스레드에서 호출 가능하며 링이 가득 차면 대기
+    void write(const char* data, size_t len) override;
+    void flush() override; // Hands gathered small writes to the ring / 모아 둔 작은 쓰기를 링에 전달
+    // Called once, from any thread, after the producer is done; waits until everything is
+    // indexed, then finalizes the graph / 생산자 종료 후 아무 스레드에서 한 번 호출하며, 모두 색인된 뒤 그래프 완성
+    void finish();
+    // For a closed view: ingesting stops and later writes are dropped / 닫힌 뷰용: 수집을 멈추고 이후 쓰기는 버림
+    void abandon() { m_ring.close(); }
+    bool isFinished() const { return m_finished; }
+
+    // Safe from any thread while streaming / 스트리밍 중에도 모든 스레드에서 안전
+    size_t lineCount() const { return m_lines.load(std::memory_order_acquire); }
+    size_t longestLine() const { return m_longest.load(std::memory_order_relaxed); }
+    std::string line(size_t n) const;
+    bool saveTo(const std::string& path) const;
+    Throughput throughput() const;
+
+    // Records are complete once finished; before that, read them through withRecords().
+    // Both stay empty for a feed built without records.
+    // 레코드는 완료 후 완전하며, 그 전에는 withRecords()로 읽기. 레코드 없이 만든 피드는 둘 다 비어 있음
+    template <class F> auto withRecords(F f) const {
+        std::lock_guard<std::mutex> guard(m_recordLock);
+        return f(m_listing);
+    }
+    const Listing& listing() const { return m_listing; }
+    const ControlFlowGraph& graph() const { return m_graph; }
+
+private:
+    void run();
+
+    ByteRing m_ring{kRingBytes};
+    std::string m_pending; // Producer side only / 생산자 전용
+    LineStore m_store;
+    Listing m_listing;
+    ControlFlowGraph m_graph;
+    LineSink m_recordFeed;
+    const bool m_records;
+    mutable std::mutex m_storeLock;
+    mutable std::mutex m_recordLock;
+    std::atomic<size_t> m_lines{0};
+    std::atomic<size_t> m_longest{0};
+    std::atomic<long long> m_bytes{0};
+    std::atomic<long long> m_startNs{0}; // First byte, steady clock / 첫 바이트 시각
+    std::atomic<long long> m_endNs{0};   // Last batch / 마지막 묶음 시각
+    std::atomic<bool> m_finished{false};
+    std::thread m_thread;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Read-only memory-mapped file / 읽기 전용 메모리 매핑 파일
+ * Rheehose (Rhee Creative) 2008-2026
+ */
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return false;
+        }
+        m_size = static_cast<size_t>(st.st_size);
+        m_opened = true;
+        if (m_size > 0) {
+            void* p = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                m_size = 0;
+                m_opened = false;
+            } else {
+                m_data = static_cast<const unsigned char*>(p);
+            }
+        }
+        ::close(fd);
+        return m_opened;
+    }
+
+    void close() {
+        if (m_data) munmap(const_cast<unsigned char*>(m_data), m_size);
+        m_data = nullptr;
+        m_size = 0;
+        m_opened = false;
+    }
+
+    // Hints the kernel that the mapping is read front to back / 순차 읽기 힌트
+    void adviseSequential() const {
+        if (m_data) madvise(const_cast<unsigned char*>(m_data), m_size, MADV_SEQUENTIAL);
+    }
+
+    bool isOpen() const { return m_opened; }
+    const unsigned char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    const unsigned char* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_opened = false;
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,224 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Progress Implementation - Address tracking over objdump chunks
+ */
+#include "progress.h"
+#include <algorithm>
+#include <cstdio>
+#include <cerrno>
+#include <unistd.h>
+
+namespace {
+constexpr std::string_view kSectionHeader = "Disassembly of section ";
+constexpr int kMaxBacktrackLines = 16; // Lines searched from the end of a chunk / 청크 끝에서 찾는 행 수
+}
+
+void CodeProgress::reset(const BinaryInfo& info) {
+    m_ranges.clear();
+    m_total = 0;
+    for (const BinaryInfo::Section& s : info.codeSections()) {
+        m_ranges.push_back({s.name, s.vma, s.size, m_total});
+        m_total += s.size;
+    }
+    m_current = m_ranges.size();
+    m_covered = 0;
+    m_bytes = 0;
+    m_start = std::chrono::steady_clock::now();
+}
+
+void CodeProgress::finish() {
+    m_covered = m_total;
+}
+
+const CodeProgress::Range* CodeProgress::rangeFor(uint64_t address) const {
+    for (const Range& r : m_ranges) {
+        if (address >= r.vma && address - r.vma < r.size) return &r;
+    }
+    return nullptr;
+}
+
+bool CodeProgress::lastAddress(std::string_view chunk, size_t from, uint64_t& address) {
+    // Instruction lines look like "  401126:\t55  push rbp" / 명령어 행 형식
+    size_t end = chunk.size();
+    for (int lines = 0; lines < kMaxBacktrackLines && end > from; ++lines) {
+        size_t nl = chunk.rfind('\n', end - 1);
+        // A line without its start belongs to the previous chunk / 시작이 없는 행은 이전 청크 소속
+        if (nl == std::string_view::npos || nl < from) return false;
+        size_t p = nl + 1;
+        while (p < end && chunk[p] == ' ') ++p;
+        uint64_t value = 0;
+        size_t digits = 0;
+        for (; p < end && digits < 17; ++p, ++digits) {
+            char c = chunk[p];
+            int v = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+            if (v < 0) break;
+            value = (value << 4) | static_cast<uint64_t>(v);
+        }
+        if (digits > 0 && digits <= 16 && p + 1 < end && chunk[p] == ':' && chunk[p + 1] == '\t') {
+            address = value;
+            return true;
+        }
+        end = nl;
+    }
+    return false;
+}
+
+void CodeProgress::write(const char* data, size_t len) {
+    m_bytes += static_cast<long long>(len);
+    scan(std::string_view(data, len));
+}
+
+void CodeProgress::observe(std::string_view tail, long long listingBytes) {
+    m_bytes = listingBytes;
+    scan(tail);
+}
+
+void CodeProgress::scan(std::string_view chunk) {
+    if (m_ranges.empty()) return;
+    uint64_t covered = m_covered.load(std::memory_order_relaxed);
+
+    // The last section header names the section the following lines belong to
+    // 마지막 섹션 머리글이 이후 행이 속한 섹션을 알려줌
+    size_t header = chunk.rfind(kSectionHeader);
+    size_t from = 0;
+    if (header != std::string_view::npos) {
+        size_t nameStart = header + kSectionHeader.size();
+        size_t colon = chunk.find(":\n", nameStart);
+        if (colon != std::string_view::npos) {
+            std::string_view name = chunk.substr(nameStart, colon - nameStart);
+            for (size_t k = 0; k < m_ranges.size(); ++k) {
+                if (m_ranges[k].name == name) {
+                    m_current = k;
+                    covered = std::max(covered, m_ranges[k].before);
+                    break;
+                }
+            }
+            from = colon;
+        }
+    }
+
+    uint64_t address;
+    if (lastAddress(chunk, from, address)) {
+        // Relocatable objects reuse addresses per section, so prefer the current one
+        // 재배치 객체는 섹션마다 주소를 재사용하므로 현재 섹션을 우선
+        const Range* r = nullptr;
+        if (m_current < m_ranges.size()) {
+            const Range& cur = m_ranges[m_current];
+            if (address >= cur.vma && address - cur.vma < cur.size) r = &cur;
+        }
+        if (!r) r = rangeFor(address);
+        if (r) covered = std::max(covered, r->before + (address - r->vma));
+    }
+    m_covered.store(covered, std::memory_order_relaxed);
+}
+
+CodeProgress::Snapshot CodeProgress::snapshot() const {
+    Snapshot s;
+    s.covered = m_covered.load(std::memory_order_relaxed);
+    s.total = m_total;
+    s.listingBytes = m_bytes.load(std::memory_order_relaxed);
+    s.elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+    return s;
+}
+
+double CodeProgress::Snapshot::eta() const {
+    double rate = codeRate();
+    if (!known() || rate <= 0) return -1;
+    return (total - covered) / rate;
+}
+
+std::string CodeProgress::Snapshot::toText() const {
+    char line[96];
+    if (!known()) {
+        snprintf(line, sizeof(line), "[%.1f MB]", listingBytes / (1024.0 * 1024.0));
+    } else if (eta() < 0) {
+        snprintf(line, sizeof(line), "[%3d%%]", static_cast<int>(fraction() * 100));
+    } else {
+        snprintf(line, sizeof(line), "[%3d%%] %.1f MB/s, ETA %.0fs", static_cast<int>(fraction() * 100),
+                 codeRate() / (1024.0 * 1024.0), eta());
+    }
+    return line;
+}
+
+std::string CodeProgress::Snapshot::jsonFields() const {
+    char line[256];
+    double left = eta();
+    char etaText[32] = "null";
+    if (left >= 0) snprintf(etaText, sizeof(etaText), "%.2f", left);
+    snprintf(line, sizeof(line),
+             "\"covered\":%llu,\"total\":%llu,\"fraction\":%.4f,\"listing_bytes\":%lld,\"elapsed\":%.2f,"
+             "\"code_mbps\":%.2f,\"eta\":%s",
+             static_cast<unsigned long long>(covered), static_cast<unsigned long long>(total), fraction(),
+             listingBytes, elapsed, codeRate() / (1024.0 * 1024.0), etaText);
+    return line;
+}
+
+ProgressRenderer::ProgressRenderer(const CodeProgress& progress, std::string label, int eventFd,
+                                   std::chrono::milliseconds interval)
+    : m_progress(progress), m_label(std::move(label)), m_eventFd(eventFd), m_interval(interval),
+      m_tty(isatty(STDOUT_FILENO) == 1) {}
+
+void ProgressRenderer::start() {
+    if (m_started || (!m_tty && m_eventFd < 0)) return;
+    m_started = true;
+    m_thread = std::thread([this]() { run(); });
+}
+
+void ProgressRenderer::stop() {
+    if (m_started) {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        m_thread.join();
+        m_started = false;
+    } else if (m_stopping) {
+        return; // Already stopped / 이미 종료됨
+    }
+    m_stopping = true;
+    // Redirected output gets no progress line, final or periodic / 리디렉션된 출력에는 진행 행을 쓰지 않음
+    if (m_tty) draw(m_progress.snapshot(), true);
+}
+
+void ProgressRenderer::run() {
+    std::unique_lock<std::mutex> guard(m_lock);
+    while (!m_wake.wait_for(guard, m_interval, [this]() { return m_stopping; })) {
+        CodeProgress::Snapshot s = m_progress.snapshot();
+        if (m_tty) draw(s, false);
+        writeEvent(m_eventFd, "progress", s.jsonFields());
+    }
+}
+
+void ProgressRenderer::draw(const CodeProgress::Snapshot& s, bool last) {
+    std::string line = (m_tty ? "\r" : "") + m_label + " " + s.toText();
+    // Blank out what a longer previous line left behind / 이전의 더 긴 행이 남긴 부분 지우기
+    if (line.size() > m_width) m_width = line.size();
+    line.append(m_width - line.size(), ' ');
+    if (last) line += '\n';
+    const char* p = line.data();
+    size_t left = line.size();
+    while (left > 0) {
+        ssize_t n = ::write(STDOUT_FILENO, p, left);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return;
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+}
+
+void ProgressRenderer::writeEvent(int fd, const char* event, const std::string& fields) {
+    if (fd < 0) return;
+    std::string line = std::string("{\"event\":\"") + event + "\"";
+    if (!fields.empty()) line += "," + fields;
+    line += "}\n";
+    const char* p = line.data();
+    size_t left = line.size();
+    while (left > 0) {
+        ssize_t n = ::write(fd, p, left);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return; // The reader went away; progress is best effort / 읽는 쪽이 사라짐, 최선 노력
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Progress Header - Code coverage, throughput and ETA of a streaming listing
+ */
+#ifndef PROGRESS_H
+#define PROGRESS_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include "stream_sink.h"
+#include "binary_info.h"
+
+/**
+ * @brief Measures how much executable code a listing has covered / 목록이 처리한 실행 코드 양 측정
+ *
+ * objdump walks the executable sections in header order, so the address of the last
+ * instruction line in each chunk, placed within its section, gives the code bytes done
+ * out of the total executable size. Counters are atomic so another thread may take
+ * snapshots while the listing streams.
+ * objdump는 실행 섹션을 헤더 순서로 처리하므로, 청크마다 마지막 명령어 행의 주소를 해당 섹션에 대입하면
+ * 전체 실행 크기 중 처리된 코드 바이트를 알 수 있습니다. 카운터는 원자적이라 다른 스레드가 스냅숏을 읽을 수 있습니다.
+ */
+class CodeProgress : public OutputSink {
+public:
+    struct Snapshot {
+        uint64_t covered = 0;       // Code bytes behind the last instruction / 마지막 명령어까지의 코드 바이트
+        uint64_t total = 0;         // Executable bytes, 0 if unknown / 실행 바이트, 모르면 0
+        long long listingBytes = 0; // Listing text produced / 생성된 목록 텍스트
+        double elapsed = 0;         // Seconds since reset() / reset() 이후 초
+
+        bool known() const { return total > 0; }
+        double fraction() const { return total ? static_cast<double>(covered) / total : 0.0; }
+        double codeRate() const { return elapsed > 0 ? covered / elapsed : 0.0; } // Bytes/s / 초당 바이트
+        double eta() const; // Seconds left, negative when unknown / 남은 초, 모르면 음수
+        // "[ 42%] 85.1 MB/s, ETA 3s", or the listing size when the code size is unknown
+        // 코드 크기를 모르면 목록 크기 표시
+        std::string toText() const;
+        // JSON members without braces, for progress events / 진행 이벤트용 중괄호 없는 JSON 멤버
+        std::string jsonFields() const;
+    };
+
+    CodeProgress() = default;
+    explicit CodeProgress(const BinaryInfo& info) { reset(info); }
+
+    // Takes the executable sections and restarts the clock / 실행 섹션을 받고 시계를 다시 시작
+    void reset(const BinaryInfo& info);
+    // Marks every byte covered once the listing is complete / 목록 완료 시 전체 처리로 표시
+    void finish();
+
+    void write(const char* data, size_t len) override;
+    // For listings that never pass through write(): the total so far and the last bytes
+    // written, which may start mid-line / write()를 거치지 않는 목록용: 현재 총량과 마지막 바이트
+    void observe(std::string_view tail, long long listingBytes);
+    Snapshot snapshot() const;
+
+private:
+    struct Range {
+        std::string name;
+        uint64_t vma;
+        uint64_t size;
+        uint64_t before; // Sum of the preceding sections / 앞선 섹션 크기 합
+    };
+
+    const Range* rangeFor(uint64_t address) const;
+    void scan(std::string_view chunk);
+    static bool lastAddress(std::string_view chunk, size_t from, uint64_t& address);
+
+    std::vector<Range> m_ranges;
+    size_t m_current = 0; // Index into m_ranges, == size() when unknown / 현재 섹션 인덱스
+    uint64_t m_total = 0;
+    std::atomic<uint64_t> m_covered{0};
+    std::atomic<long long> m_bytes{0};
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+};
+
+/**
+ * @brief Redraws a CodeProgress line on its own thread at a fixed rate / 고정 주기로 별도 스레드에서 진행 행 갱신
+ *
+ * The reader only bumps atomic counters; this thread samples them every interval, so
+ * terminal writes no longer scale with the listing. The line is drawn only when stdout
+ * is a TTY, and progress events go to eventFd at the same rate when one is given.
+ * 읽는 쪽은 원자 카운터만 갱신하고 이 스레드가 주기마다 값을 읽으므로 터미널 쓰기가 목록 크기에 비례하지
+ * 않습니다. stdout이 TTY일 때만 행을 그리며, eventFd가 있으면 같은 주기로 진행 이벤트를 기록합니다.
+ */
+class ProgressRenderer {
+public:
+    static constexpr std::chrono::milliseconds kDefaultInterval{100};
+
+    ProgressRenderer(const CodeProgress& progress, std::string label, int eventFd = -1,
+                     std::chrono::milliseconds interval = kDefaultInterval);
+    ~ProgressRenderer() { stop(); }
+
+    ProgressRenderer(const ProgressRenderer&) = delete;
+    ProgressRenderer& operator=(const ProgressRenderer&) = delete;
+
+    void start();
+    // Joins the thread and draws the final state once on a TTY / 스레드 종료 후 TTY이면 최종 상태를 한 번 출력
+    void stop();
+
+    // {"event":"<event>",<fields>} plus newline, best effort / 최선 노력으로 한 행 기록
+    static void writeEvent(int fd, const char* event, const std::string& fields);
+
+private:
+    void run();
+    void draw(const CodeProgress::Snapshot& s, bool last);
+
+    const CodeProgress& m_progress;
+    std::string m_label;
+    int m_eventFd;
+    std::chrono::milliseconds m_interval;
+    bool m_tty;
+    size_t m_width = 0; // Longest line drawn, for padding / 패딩용 최장 행 길이
+    std::thread m_thread;
+    std::mutex m_lock;
+    std::condition_variable m_wake;
+    bool m_stopping = false;
+    bool m_started = false;
+};
+
+#endif
@@ -0,0 +1,271 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Result Cache Implementation - Hashing, atomic publication and LRU eviction
+ */
+#include "result_cache.h"
+#include <algorithm>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <sys/stat.h>
+#include <dirent.h>
+#include "mapped_file.h"
+
+namespace {
+constexpr uint64_t P1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t P3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t P5 = 0x27D4EB2F165667C5ULL;
+constexpr size_t kChunkSize = 1 << 20;
+constexpr time_t kStaleTemporarySeconds = 3600; // Left behind by a crashed writer / 중단된 작성기의 잔여물
+
+inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+inline uint64_t round(uint64_t acc, uint64_t input) { return rotl(acc + input * P2, 31) * P1; }
+inline uint64_t merge(uint64_t acc, uint64_t val) { return (acc ^ round(0, val)) * P1 + P4; }
+
+// mkdir -p / 상위 디렉터리까지 생성
+bool makeDirectories(const std::string& dir) {
+    for (size_t pos = 1; pos <= dir.size(); ++pos) {
+        if (pos != dir.size() && dir[pos] != '/') continue;
+        std::string part = dir.substr(0, pos);
+        if (mkdir(part.c_str(), 0755) != 0 && errno != EEXIST) return false;
+    }
+    struct stat st;
+    return stat(dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode) && access(dir.c_str(), W_OK) == 0;
+}
+}
+
+std::string ResultCache::defaultDirectory() {
+    const char* xdg = getenv("XDG_CACHE_HOME");
+    if (xdg && *xdg) return std::string(xdg) + "/thedecoder";
+    const char* home = getenv("HOME");
+    if (home && *home) return std::string(home) + "/.cache/thedecoder";
+    return std::string();
+}
+
+ResultCache::ResultCache(std::string dir, uint64_t maxBytes) : m_dir(std::move(dir)), m_maxBytes(maxBytes) {
+    m_enabled = !m_dir.empty() && makeDirectories(m_dir);
+}
+
+uint64_t ResultCache::hash(const void* data, size_t size, uint64_t seed) {
+    // XXH64
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + size;
+    uint64_t h;
+    if (size >= 32) {
+        uint64_t v1 = seed + P1 + P2, v2 = seed + P2, v3 = seed, v4 = seed - P1;
+        for (const unsigned char* limit = end - 32; p <= limit; p += 32) {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+        }
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge(h, v1);
+        h = merge(h, v2);
+        h = merge(h, v3);
+        h = merge(h, v4);
+    } else {
+        h = seed + P5;
+    }
+    h += size;
+    for (; p + 8 <= end; p += 8) h = rotl(h ^ round(0, read64(p)), 27) * P1 + P4;
+    if (p + 4 <= end) {
+        h = rotl(h ^ (read32(p) * P1), 23) * P2 + P3;
+        p += 4;
+    }
+    for (; p < end; ++p) h = rotl(h ^ (*p * P5), 11) * P1;
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+bool ResultCache::hashFile(const std::string& path, uint64_t& out) {
+    MappedFile map(path);
+    if (!map.isOpen()) return false;
+    map.adviseSequential();
+    out = hash(map.data(), map.size());
+    return true;
+}
+
+std::string ResultCache::key(uint64_t contentHash, std::string_view kind, std::string_view options) {
+    char name[40];
+    snprintf(name, sizeof(name), "%016llx%016llx.", static_cast<unsigned long long>(contentHash),
+             static_cast<unsigned long long>(hash(options.data(), options.size(), contentHash)));
+    return name + std::string(kind);
+}
+
+std::string ResultCache::listingOptions(bool intel, std::string_view arch) {
+    // Everything besides the input bytes that changes objdump's output / 입력 외에 objdump 출력을 바꾸는 요소
+    return std::string("intel=") + (intel ? "1" : "0") + " arch=" + std::string(arch);
+}
+
+std::string ResultCache::stringsOptions(int minLength, unsigned encodings, bool json, bool tagged) {
+    char options[64];
+    snprintf(options, sizeof(options), "min=%d encodings=%u json=%d tagged=%d", minLength, encodings, json ? 1 : 0,
+             tagged ? 1 : 0);
+    return options;
+}
+
+std::string ResultCache::lookup(const std::string& key) {
+    if (!m_enabled) return std::string();
+    std::string path = m_dir + "/" + key;
+    // Refreshing the mtime is both the existence check and the LRU stamp
+    // mtime 갱신이 존재 확인이자 LRU 기록
+    if (utimensat(AT_FDCWD, path.c_str(), nullptr, 0) != 0) return std::string();
+    return path;
+}
+
+bool ResultCache::stream(const std::string& path, OutputSink& sink, const Progress& progress) {
+    return streamListing(path, std::string_view(), sink, progress);
+}
+
+bool ResultCache::streamListing(const std::string& path, std::string_view infile, OutputSink& sink,
+                                const Progress& progress) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    std::vector<char> buffer(kChunkSize);
+    long long processed = 0;
+    bool first = true;
+    ssize_t n;
+    while ((n = ::read(fd, buffer.data(), buffer.size())) > 0 || (n < 0 && errno == EINTR)) {
+        if (n < 0) continue;
+        std::string_view chunk(buffer.data(), static_cast<size_t>(n));
+        if (first && !infile.empty()) {
+            // objdump opens with "\n<file>:     file format <bfd>\n" / objdump 머리말
+            size_t start = chunk.find_first_not_of('\n');
+            size_t token = chunk.find(":     file format ", start);
+            size_t eol = chunk.find('\n', start);
+            if (start != std::string_view::npos && token != std::string_view::npos && token < eol) {
+                sink.write(chunk.data(), start);
+                sink.write(infile.data(), infile.size());
+                chunk.remove_prefix(token);
+            }
+        }
+        first = false;
+        sink.write(chunk.data(), chunk.size());
+        processed += n;
+        if (progress) progress(processed);
+    }
+    ::close(fd);
+    sink.flush();
+    return n == 0;
+}
+
+std::string ResultCache::temporaryPath() {
+    return m_dir + "/.tmp-" + std::to_string(getpid()) + "-" + std::to_string(m_serial.fetch_add(1));
+}
+
+ResultCache::Writer::Writer(ResultCache& cache, std::string key)
+    : m_cache(cache), m_key(std::move(key)), m_tmp(cache.isEnabled() ? cache.temporaryPath() : std::string()),
+      m_file(m_tmp) {}
+
+ResultCache::Writer::~Writer() {
+    if (m_done || !m_file.isOpen()) return;
+    m_file.close();
+    unlink(m_tmp.c_str());
+}
+
+void ResultCache::Writer::write(const char* data, size_t len) {
+    m_file.write(data, len);
+    m_bytes += len;
+}
+
+bool ResultCache::Writer::copyFrom(int fd, uint64_t len) {
+    if (!m_file.isOpen()) return false;
+    m_file.flush();
+    loff_t offset = 0;
+    while (static_cast<uint64_t>(offset) < len) {
+        ssize_t n = copy_file_range(fd, &offset, m_file.fd(), nullptr, len - offset, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        m_bytes += static_cast<uint64_t>(n);
+    }
+    // Older kernels and cross-filesystem copies fall back to pread / 구형 커널이나 파일 시스템 간 복사는 pread로 대체
+    std::vector<char> buffer;
+    while (static_cast<uint64_t>(offset) < len) {
+        if (buffer.empty()) buffer.resize(kChunkSize);
+        ssize_t n = pread(fd, buffer.data(), std::min<uint64_t>(buffer.size(), len - offset), offset);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        write(buffer.data(), static_cast<size_t>(n));
+        offset += n;
+    }
+    m_file.flush();
+    return m_file.good();
+}
+
+bool ResultCache::Writer::commit() {
+    if (m_done || !m_file.isOpen()) return false;
+    m_done = true;
+    m_file.close();
+    // rename() replaces any concurrent copy of the same entry atomically
+    // rename()은 같은 항목의 동시 사본을 원자적으로 교체
+    if (!m_file.good() || rename(m_tmp.c_str(), (m_cache.m_dir + "/" + m_key).c_str()) != 0) {
+        unlink(m_tmp.c_str());
+        return false;
+    }
+    m_cache.account(m_bytes);
+    return true;
+}
+
+void ResultCache::account(uint64_t bytes) {
+    if (m_usage.load() < 0 || (m_usage += static_cast<int64_t>(bytes)) > static_cast<int64_t>(m_maxBytes)) evict();
+}
+
+void ResultCache::evict() {
+    if (!m_enabled) return;
+    std::lock_guard<std::mutex> guard(m_evictLock);
+    struct Item {
+        struct timespec used;
+        uint64_t size;
+        std::string path;
+    };
+    std::vector<Item> items;
+    uint64_t total = 0;
+    time_t now = time(nullptr);
+    DIR* dir = opendir(m_dir.c_str());
+    if (!dir) return;
+    while (dirent* ent = readdir(dir)) {
+        std::string name = ent->d_name;
+        if (name == "." || name == "..") continue;
+        std::string path = m_dir + "/" + name;
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) continue;
+        if (name.compare(0, 5, ".tmp-") == 0) {
+            if (now - st.st_mtime > kStaleTemporarySeconds) unlink(path.c_str());
+            continue;
+        }
+        items.push_back({st.st_mtim, static_cast<uint64_t>(st.st_size), path});
+        total += static_cast<uint64_t>(st.st_size);
+    }
+    closedir(dir);
+
+    if (total > m_maxBytes) {
+        std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+            return a.used.tv_sec != b.used.tv_sec ? a.used.tv_sec < b.used.tv_sec : a.used.tv_nsec < b.used.tv_nsec;
+        });
+        uint64_t target = m_maxBytes / 10 * 9;
+        // A reader that already opened an entry keeps its data after unlink / 이미 연 읽기는 unlink 후에도 유효
+        for (const Item& item : items) {
+            if (total <= target) break;
+            if (unlink(item.path.c_str()) == 0 || errno == ENOENT) total -= item.size;
+        }
+    }
+    m_usage = static_cast<int64_t>(total);
+}
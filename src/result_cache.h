@@ -0,0 +1,110 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Result Cache Header - Content-addressed cache for listings, graphs and strings
+ */
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <cstdint>
+#include "stream_sink.h"
+
+/**
+ * @brief On-disk result cache keyed by input bytes and output options
+ * 입력 바이트와 출력 옵션을 키로 하는 디스크 결과 캐시
+ *
+ * Entries live in one directory (~/.cache/thedecoder by default) as
+ * "<content hash><options hash>.<kind>". They are written to a temporary file and
+ * renamed into place, so readers in other threads or processes only ever see complete
+ * entries. A hit refreshes the entry's mtime, and eviction removes the least recently
+ * used entries once the directory grows past its byte budget.
+ * 항목은 한 디렉터리에 "<내용 해시><옵션 해시>.<종류>"로 저장됩니다. 임시 파일에 쓴 뒤 이름을 바꾸므로
+ * 다른 스레드나 프로세스는 완성된 항목만 보게 됩니다. 적중 시 mtime을 갱신하고, 용량을 넘으면
+ * 가장 오래 사용되지 않은 항목부터 제거합니다.
+ */
+class ResultCache {
+public:
+    static constexpr uint64_t kDefaultMaxBytes = 2ULL << 30; // 2 GiB
+    using Progress = std::function<void(long long)>;
+
+    // $XDG_CACHE_HOME/thedecoder, else ~/.cache/thedecoder / 기본 캐시 디렉터리
+    static std::string defaultDirectory();
+
+    explicit ResultCache(std::string dir = defaultDirectory(), uint64_t maxBytes = kDefaultMaxBytes);
+
+    bool isEnabled() const { return m_enabled; }
+    const std::string& directory() const { return m_dir; }
+
+    // XXH64 of a buffer, and of a whole file (mapped) / 버퍼 및 파일 전체(매핑)의 XXH64
+    static uint64_t hash(const void* data, size_t size, uint64_t seed = 0);
+    static bool hashFile(const std::string& path, uint64_t& out);
+
+    // Entry name for one output kind ("asm", "mermaid", "strings") / 출력 종류별 항목 이름
+    static std::string key(uint64_t contentHash, std::string_view kind, std::string_view options);
+
+    // Option strings shared by every producer of a kind, so the CLI, batch and IDE hit the same entries
+    // 종류별 공통 옵션 문자열, CLI, 배치, IDE가 같은 항목을 공유
+    static std::string listingOptions(bool intel, std::string_view arch);
+    static std::string stringsOptions(int minLength, unsigned encodings, bool json, bool tagged);
+
+    // Full path of a cached entry, or empty on a miss / 캐시 항목 전체 경로, 없으면 빈 값
+    std::string lookup(const std::string& key);
+
+    // Streams an entry into sink; false if it vanished / 항목을 sink로 스트리밍, 사라졌으면 false
+    static bool stream(const std::string& path, OutputSink& sink, const Progress& progress = nullptr);
+    // Same for an objdump listing, naming infile in the "<file>: file format" preamble
+    // objdump 목록용, 머리말의 "<파일>: file format"을 infile로 바꿔 스트리밍
+    static bool streamListing(const std::string& path, std::string_view infile, OutputSink& sink,
+                              const Progress& progress = nullptr);
+
+    /**
+     * @brief Streams a new entry to a temporary file; commit() publishes it atomically
+     * 새 항목을 임시 파일로 스트리밍하고 commit()이 원자적으로 게시
+     * Destroying an uncommitted writer discards the partial entry.
+     * 커밋되지 않은 작성기가 소멸되면 불완전한 항목은 버려집니다.
+     */
+    class Writer : public OutputSink {
+    public:
+        Writer(ResultCache& cache, std::string key);
+        ~Writer() override;
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        void write(const char* data, size_t len) override;
+        void flush() override { m_file.flush(); }
+        // Appends the first len bytes of a readable fd, in the kernel where possible
+        // 읽기 가능한 fd의 처음 len 바이트를 가능하면 커널 안에서 추가
+        bool copyFrom(int fd, uint64_t len);
+        bool commit();
+
+    private:
+        ResultCache& m_cache;
+        std::string m_key;
+        std::string m_tmp;
+        FileSink m_file;
+        uint64_t m_bytes = 0;
+        bool m_done = false;
+    };
+
+    // Drops least recently used entries until usage is under 90% of the budget
+    // 사용량이 한도의 90% 아래가 될 때까지 가장 오래 사용되지 않은 항목 제거
+    void evict();
+
+private:
+    void account(uint64_t bytes);
+    std::string temporaryPath();
+
+    std::string m_dir;
+    uint64_t m_maxBytes;
+    bool m_enabled = false;
+    std::atomic<int64_t> m_usage{-1}; // Bytes on disk, -1 until first scanned / 디스크 사용량, 첫 스캔 전 -1
+    std::atomic<uint64_t> m_serial{0};
+    std::mutex m_evictLock;
+};
+
+#endif
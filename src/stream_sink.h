@@ -0,0 +1,159 @@
+#ifndef STREAM_SINK_H
+#define STREAM_SINK_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief Streaming Sink Pipeline / 스트리밍 싱크 파이프라인
+ * objdump output flows through sinks chunk by chunk so memory stays bounded.
+ * objdump 출력은 청크 단위로 싱크를 통과하므로 메모리 사용량이 제한됩니다.
+ * Rheehose (Rhee Creative) 2008-2026
+ */
+
+class OutputSink {
+public:
+    virtual ~OutputSink() = default;
+    virtual void write(const char* data, size_t len) = 0;
+    virtual void flush() {}
+};
+
+/**
+ * @brief Large buffered file writer / 대용량 버퍼 파일 작성기
+ */
+class FileSink : public OutputSink {
+public:
+    static constexpr size_t kBufferSize = 1 << 20; // 1 MiB
+
+    explicit FileSink(const std::string& path) {
+        m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (m_fd >= 0) m_buf.reserve(kBufferSize);
+        else m_failed = true;
+    }
+    // Borrows an open descriptor such as stdout; close() flushes but leaves it open
+    // stdout 같은 열린 디스크립터를 빌려 사용하며 close()는 닫지 않고 비우기만 함
+    explicit FileSink(int fd) : m_fd(fd), m_owned(false) {
+        m_buf.reserve(kBufferSize);
+    }
+    ~FileSink() override { close(); }
+
+    FileSink(const FileSink&) = delete;
+    FileSink& operator=(const FileSink&) = delete;
+
+    bool isOpen() const { return m_fd >= 0; }
+    bool good() const { return !m_failed; }
+    // For writers that bypass the buffer; flush() first / 버퍼를 거치지 않는 기록용, 먼저 flush()
+    int fd() const { return m_fd; }
+
+    void write(const char* data, size_t len) override {
+        if (m_fd < 0) return;
+        if (m_buf.size() + len > kBufferSize) flush();
+        // Oversized chunks bypass the buffer / 버퍼보다 큰 청크는 직접 기록
+        if (len >= kBufferSize) {
+            writeAll(data, len);
+            return;
+        }
+        m_buf.insert(m_buf.end(), data, data + len);
+    }
+
+    void flush() override {
+        if (m_fd < 0 || m_buf.empty()) return;
+        writeAll(m_buf.data(), m_buf.size());
+        m_buf.clear();
+    }
+
+    void close() {
+        if (m_fd < 0) return;
+        flush();
+        if (m_owned && ::close(m_fd) != 0) m_failed = true;
+        m_fd = -1;
+    }
+
+private:
+    void writeAll(const char* data, size_t len) {
+        while (len > 0) {
+            ssize_t n = ::write(m_fd, data, len);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                m_failed = true;
+                return;
+            }
+            data += n;
+            len -= static_cast<size_t>(n);
+        }
+    }
+
+    int m_fd = -1;
+    bool m_owned = true;
+    bool m_failed = false;
+    std::vector<char> m_buf;
+};
+
+/**
+ * @brief Reassembles lines split across chunk boundaries / 청크 경계에서 잘린 행 재조립
+ * The callback receives each line without its trailing newline.
+ * 콜백은 끝의 개행 문자가 제거된 각 행을 전달받습니다.
+ */
+class LineSink : public OutputSink {
+public:
+    using Callback = std::function<void(std::string_view)>;
+
+    explicit LineSink(Callback cb) : m_cb(std::move(cb)) {}
+
+    void write(const char* data, size_t len) override {
+        const char* end = data + len;
+        while (data < end) {
+            const char* nl = static_cast<const char*>(std::memchr(data, '\n', end - data));
+            if (!nl) {
+                m_carry.append(data, end - data);
+                return;
+            }
+            if (m_carry.empty()) {
+                m_cb(std::string_view(data, nl - data));
+            } else {
+                m_carry.append(data, nl - data);
+                m_cb(m_carry);
+                m_carry.clear();
+            }
+            data = nl + 1;
+        }
+    }
+
+    // Emits a trailing line that had no newline / 개행 없는 마지막 행 전달
+    void flush() override {
+        if (m_carry.empty()) return;
+        m_cb(m_carry);
+        m_carry.clear();
+    }
+
+private:
+    Callback m_cb;
+    std::string m_carry;
+};
+
+/**
+ * @brief Fans one chunk out to several sinks / 하나의 청크를 여러 싱크로 분배
+ */
+class TeeSink : public OutputSink {
+public:
+    void add(OutputSink* sink) { m_sinks.push_back(sink); }
+
+    void write(const char* data, size_t len) override {
+        for (OutputSink* s : m_sinks) s->write(data, len);
+    }
+
+    void flush() override {
+        for (OutputSink* s : m_sinks) s->flush();
+    }
+
+private:
+    std::vector<OutputSink*> m_sinks;
+};
+
+#endif // STREAM_SINK_H
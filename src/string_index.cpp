@@ -0,0 +1,418 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * String Index Implementation - Trigram posting lists in a single mapped file
+ */
+#include "string_index.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <queue>
+
+/*
+ * File layout, every region 8-byte aligned / 파일 형식, 모든 영역 8바이트 정렬
+ *   Header
+ *   Entry[stringCount]            offset, vaddr, text span, section, encoding
+ *   Section[sectionCount]         name spans into the text blob
+ *   Gram[gramCount]               sorted by gram
+ *   postings                      per gram: varint deltas of ascending string ids
+ *   text                          string texts, then section names, then the source path
+ */
+namespace {
+constexpr char kMagic[8] = {'T', 'D', 'X', 'I', 'D', 'X', '0', '1'};
+constexpr uint16_t kNoSection = 0xffff;
+
+struct Header {
+    char magic[8];
+    uint64_t stringCount;
+    uint64_t gramCount;
+    uint64_t sectionCount;
+    uint64_t entriesOffset;
+    uint64_t sectionsOffset;
+    uint64_t gramsOffset;
+    uint64_t postingsOffset;
+    uint64_t postingsLength;
+    uint64_t textOffset;
+    uint64_t textLength;
+    uint64_t sourceOffset; // Into the text blob / 텍스트 블롭 기준
+    uint64_t sourceLength;
+};
+
+struct SectionName {
+    uint64_t textOffset;
+    uint64_t length;
+};
+
+struct Gram {
+    uint32_t gram;
+    uint32_t count;
+    uint64_t postingOffset;
+};
+
+template <typename T>
+T load(const unsigned char* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+uint64_t align8(uint64_t n) { return (n + 7) & ~uint64_t(7); }
+
+uint32_t gramAt(const char* p) {
+    return static_cast<uint32_t>(static_cast<unsigned char>(p[0])) << 16 |
+           static_cast<uint32_t>(static_cast<unsigned char>(p[1])) << 8 |
+           static_cast<uint32_t>(static_cast<unsigned char>(p[2]));
+}
+
+void putVarint(std::string& out, uint32_t v) {
+    while (v >= 0x80) {
+        out += static_cast<char>(v | 0x80);
+        v >>= 7;
+    }
+    out += static_cast<char>(v);
+}
+
+void sortUnique(std::vector<uint64_t>& v) {
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+}
+
+// Sorted pair runs in temporary files, merged back in order / 임시 파일의 정렬된 쌍 실행을 순서대로 병합
+class SpilledRuns {
+public:
+    SpilledRuns() = default;
+    SpilledRuns(const SpilledRuns&) = delete;
+    SpilledRuns& operator=(const SpilledRuns&) = delete;
+    ~SpilledRuns() {
+        for (FILE* run : m_runs) fclose(run);
+    }
+
+    bool empty() const { return m_runs.empty(); }
+
+    bool spill(const std::vector<uint64_t>& pairs) {
+        FILE* run = tmpfile();
+        if (!run) return false;
+        if (fwrite(pairs.data(), sizeof(uint64_t), pairs.size(), run) != pairs.size() || fflush(run) != 0) {
+            fclose(run);
+            return false;
+        }
+        m_runs.push_back(run);
+        return true;
+    }
+
+    // k-way merge of the runs and the sorted tail; false on a read error / 실행과 정렬된 나머지를 병합
+    template <typename Fn>
+    bool merge(const std::vector<uint64_t>& tail, Fn&& emit) {
+        std::vector<Reader> readers;
+        for (FILE* run : m_runs) {
+            rewind(run);
+            readers.emplace_back(run);
+        }
+        size_t taken = 0;
+        // Source readers.size() is the tail / 소스 readers.size()가 나머지
+        auto next = [&](size_t src, uint64_t& value) {
+            if (src < readers.size()) return readers[src].next(value);
+            if (taken == tail.size()) return false;
+            value = tail[taken++];
+            return true;
+        };
+        using Head = std::pair<uint64_t, size_t>;
+        std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+        for (size_t src = 0; src <= readers.size(); ++src) {
+            uint64_t value;
+            if (next(src, value)) heads.emplace(value, src);
+        }
+        while (!heads.empty()) {
+            Head head = heads.top();
+            heads.pop();
+            emit(head.first);
+            uint64_t value;
+            if (next(head.second, value)) heads.emplace(value, head.second);
+        }
+        for (FILE* run : m_runs) {
+            if (ferror(run)) return false;
+        }
+        return true;
+    }
+
+private:
+    class Reader {
+    public:
+        explicit Reader(FILE* file) : m_file(file), m_buf(1 << 12) {}
+        bool next(uint64_t& value) {
+            if (m_pos == m_len) {
+                m_len = fread(m_buf.data(), sizeof(uint64_t), m_buf.size(), m_file);
+                m_pos = 0;
+                if (m_len == 0) return false;
+            }
+            value = m_buf[m_pos++];
+            return true;
+        }
+
+    private:
+        FILE* m_file;
+        std::vector<uint64_t> m_buf;
+        size_t m_pos = 0;
+        size_t m_len = 0;
+    };
+
+    std::vector<FILE*> m_runs;
+};
+
+// Region [offset, offset + count * unit) inside the file / 파일 안의 영역인지 확인
+bool fits(uint64_t offset, uint64_t count, uint64_t unit, uint64_t fileSize) {
+    if (offset > fileSize) return false;
+    return count <= (fileSize - offset) / unit;
+}
+}
+
+void StringIndexWriter::write(const Record& r) {
+    uint16_t section = kNoSection;
+    if (!r.section.empty()) {
+        auto it = m_sectionIds.find(std::string(r.section));
+        if (it != m_sectionIds.end()) {
+            section = it->second;
+        } else if (m_sections.size() < kNoSection) {
+            section = static_cast<uint16_t>(m_sections.size());
+            m_sections.emplace_back(r.section);
+            m_sectionIds.emplace(m_sections.back(), section);
+        }
+    }
+    m_entries.push_back(Entry{r.offset, r.vaddr, m_text.size(), static_cast<uint32_t>(r.text.size()), section,
+                              static_cast<uint8_t>(r.encoding), static_cast<uint8_t>(r.hasVaddr)});
+    m_text.append(r.text.data(), r.text.size());
+}
+
+bool StringIndexWriter::save(const std::string& path, std::string_view source) const {
+    // (gram << 32 | id) sorts by gram, then by id. A record's pairs never straddle runs, so
+    // the runs hold ascending id ranges / gram, id 순으로 정렬되며 레코드의 쌍은 실행을 넘지 않음
+    SpilledRuns runs;
+    std::vector<uint64_t> pairs;
+    bool spilling = true;
+    for (uint32_t id = 0; id < m_entries.size(); ++id) {
+        const Entry& e = m_entries[id];
+        const char* t = m_text.data() + e.textOffset;
+        for (uint32_t i = 0; i + 3 <= e.textLength; ++i) {
+            pairs.push_back(static_cast<uint64_t>(gramAt(t + i)) << 32 | id);
+        }
+        if (pairs.size() >= kRunPairs && spilling) {
+            sortUnique(pairs);
+            // Without a temporary file the pairs stay buffered / 임시 파일이 없으면 버퍼에 유지
+            spilling = runs.spill(pairs);
+            if (spilling) pairs.clear();
+        }
+    }
+    sortUnique(pairs);
+
+    std::vector<Gram> grams;
+    std::string postings;
+    uint32_t prev = 0;
+    auto add = [&](uint64_t pair) {
+        uint32_t gram = static_cast<uint32_t>(pair >> 32);
+        uint32_t id = static_cast<uint32_t>(pair);
+        if (grams.empty() || grams.back().gram != gram) {
+            grams.push_back(Gram{gram, 0, postings.size()});
+            prev = 0;
+        }
+        putVarint(postings, id - prev);
+        prev = id;
+        ++grams.back().count;
+    };
+    if (runs.empty()) {
+        for (uint64_t pair : pairs) add(pair);
+    } else if (!runs.merge(pairs, add)) {
+        return false; // A short read would drop postings / 짧은 읽기는 목록을 잃음
+    }
+
+    // Section names and the source path follow the strings in the text blob
+    // 섹션 이름과 원본 경로는 텍스트 블롭에서 문자열 뒤에 위치
+    std::vector<SectionName> names;
+    uint64_t tail = m_text.size();
+    for (const std::string& s : m_sections) {
+        names.push_back(SectionName{tail, s.size()});
+        tail += s.size();
+    }
+
+    Header h;
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.stringCount = m_entries.size();
+    h.gramCount = grams.size();
+    h.sectionCount = names.size();
+    h.entriesOffset = align8(sizeof(Header));
+    h.sectionsOffset = align8(h.entriesOffset + m_entries.size() * sizeof(Entry));
+    h.gramsOffset = align8(h.sectionsOffset + names.size() * sizeof(SectionName));
+    h.postingsOffset = align8(h.gramsOffset + grams.size() * sizeof(Gram));
+    h.postingsLength = postings.size();
+    h.textOffset = align8(h.postingsOffset + postings.size());
+    h.sourceOffset = tail;
+    h.sourceLength = source.size();
+    h.textLength = tail + source.size();
+
+    std::string tmp = path + ".tmp";
+    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return false;
+    uint64_t pos = 0;
+    auto put = [&](const void* data, uint64_t len) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(len));
+        pos += len;
+    };
+    auto padTo = [&](uint64_t offset) {
+        static const char zeros[8] = {};
+        put(zeros, offset - pos);
+    };
+    put(&h, sizeof(h));
+    padTo(h.entriesOffset);
+    put(m_entries.data(), m_entries.size() * sizeof(Entry));
+    padTo(h.sectionsOffset);
+    put(names.data(), names.size() * sizeof(SectionName));
+    padTo(h.gramsOffset);
+    put(grams.data(), grams.size() * sizeof(Gram));
+    padTo(h.postingsOffset);
+    put(postings.data(), postings.size());
+    padTo(h.textOffset);
+    put(m_text.data(), m_text.size());
+    for (const std::string& s : m_sections) put(s.data(), s.size());
+    put(source.data(), source.size());
+    out.close();
+    if (!out) {
+        std::remove(tmp.c_str());
+        return false;
+    }
+    // Readers never see a half-written index / 읽는 쪽은 반쯤 쓰인 인덱스를 보지 않음
+    return std::rename(tmp.c_str(), path.c_str()) == 0;
+}
+
+bool StringIndex::open(const std::string& path) {
+    m_open = false;
+    if (!m_map.open(path) || m_map.size() < sizeof(Header)) return false;
+    const unsigned char* base = m_map.data();
+    uint64_t size = m_map.size();
+    Header h = load<Header>(base);
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) return false;
+    if (!fits(h.entriesOffset, h.stringCount, sizeof(StringIndexWriter::Entry), size) ||
+        !fits(h.sectionsOffset, h.sectionCount, sizeof(SectionName), size) ||
+        !fits(h.gramsOffset, h.gramCount, sizeof(Gram), size) ||
+        !fits(h.postingsOffset, h.postingsLength, 1, size) ||
+        !fits(h.textOffset, h.textLength, 1, size) ||
+        h.sourceOffset > h.textLength || h.sourceLength > h.textLength - h.sourceOffset ||
+        h.stringCount > 0xffffffffu) {
+        return false;
+    }
+
+    m_stringCount = h.stringCount;
+    m_gramCount = h.gramCount;
+    m_sectionCount = h.sectionCount;
+    m_entries = base + h.entriesOffset;
+    m_sections = base + h.sectionsOffset;
+    m_grams = base + h.gramsOffset;
+    m_postings = base + h.postingsOffset;
+    m_postingsLength = h.postingsLength;
+    m_text = reinterpret_cast<const char*>(base + h.textOffset);
+    m_textLength = h.textLength;
+    m_source = std::string_view(m_text + h.sourceOffset, h.sourceLength);
+    m_open = true;
+    return true;
+}
+
+StringsSink::Record StringIndex::record(uint32_t id) const {
+    auto e = load<StringIndexWriter::Entry>(m_entries + id * sizeof(StringIndexWriter::Entry));
+    StringsSink::Record r;
+    r.offset = e.offset;
+    r.vaddr = e.vaddr;
+    r.hasVaddr = e.hasVaddr != 0;
+    r.encoding = static_cast<StringsExtractor::Encoding>(e.encoding);
+    if (e.textOffset <= m_textLength && e.textLength <= m_textLength - e.textOffset) {
+        r.text = std::string_view(m_text + e.textOffset, e.textLength);
+    }
+    r.size = r.text.size();
+    if (r.encoding == StringsExtractor::Utf16LE || r.encoding == StringsExtractor::Utf16BE) {
+        // Two file bytes per stored character / 저장된 문자당 파일 2바이트
+        r.size = 0;
+        for (char c : r.text) {
+            if ((static_cast<unsigned char>(c) & 0xC0) != 0x80) r.size += 2;
+        }
+    }
+    if (e.section < m_sectionCount) {
+        auto s = load<SectionName>(m_sections + e.section * sizeof(SectionName));
+        if (s.textOffset <= m_textLength && s.length <= m_textLength - s.textOffset) {
+            r.section = std::string_view(m_text + s.textOffset, s.length);
+        }
+    }
+    r.file = m_source;
+    return r;
+}
+
+void StringIndex::decodePostings(uint32_t gram, std::vector<uint32_t>& out) const {
+    out.clear();
+    // Binary search over the fixed-size gram table / 고정 크기 gram 표 이진 탐색
+    uint64_t lo = 0, hi = m_gramCount;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (load<Gram>(m_grams + mid * sizeof(Gram)).gram < gram) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == m_gramCount) return;
+    Gram g = load<Gram>(m_grams + lo * sizeof(Gram));
+    if (g.gram != gram) return;
+
+    out.reserve(g.count);
+    uint64_t pos = g.postingOffset;
+    uint32_t id = 0;
+    for (uint32_t n = 0; n < g.count; ++n) {
+        uint32_t delta = 0;
+        for (int shift = 0; pos < m_postingsLength && shift < 35; shift += 7) {
+            unsigned char b = m_postings[pos++];
+            delta |= static_cast<uint32_t>(b & 0x7f) << shift;
+            if (!(b & 0x80)) break;
+        }
+        id += delta;
+        if (id >= m_stringCount) break; // Corrupt list / 손상된 목록
+        out.push_back(id);
+    }
+}
+
+std::vector<uint32_t> StringIndex::candidates(std::string_view pattern) const {
+    std::vector<uint32_t> grams;
+    for (size_t i = 0; i + 3 <= pattern.size(); ++i) grams.push_back(gramAt(pattern.data() + i));
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+
+    std::vector<uint32_t> result, list, merged;
+    for (size_t k = 0; k < grams.size(); ++k) {
+        decodePostings(grams[k], list);
+        if (k == 0) {
+            result.swap(list);
+        } else {
+            merged.clear();
+            std::set_intersection(result.begin(), result.end(), list.begin(), list.end(), std::back_inserter(merged));
+            result.swap(merged);
+        }
+        if (result.empty()) break;
+    }
+    return result;
+}
+
+bool StringIndex::matches(uint32_t id, std::string_view pattern, Match mode) const {
+    auto e = load<StringIndexWriter::Entry>(m_entries + id * sizeof(StringIndexWriter::Entry));
+    if (e.textOffset > m_textLength || e.textLength > m_textLength - e.textOffset) return false;
+    std::string_view text(m_text + e.textOffset, e.textLength);
+    if (mode == Match::Prefix) return text.substr(0, pattern.size()) == pattern;
+    return text.find(pattern) != std::string_view::npos;
+}
+
+size_t StringIndex::query(std::string_view pattern, Match mode, StringsSink& sink) const {
+    if (!m_open) return 0;
+    size_t count = 0;
+    auto emit = [&](uint32_t id) {
+        if (!matches(id, pattern, mode)) return;
+        sink.write(record(id));
+        ++count;
+    };
+    if (pattern.size() < 3) {
+        for (uint32_t id = 0; id < m_stringCount; ++id) emit(id);
+    } else {
+        for (uint32_t id : candidates(pattern)) emit(id);
+    }
+    return count;
+}
@@ -0,0 +1,102 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * String Index Header - Persistent trigram index over extracted strings
+ */
+#ifndef STRING_INDEX_H
+#define STRING_INDEX_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "strings_sink.h"
+#include "mapped_file.h"
+
+/**
+ * @brief Builds a .tdx index while strings stream past / 문자열이 스트리밍되는 동안 .tdx 인덱스 생성
+ *
+ * Every record (text, offset, vaddr, section, encoding) is kept, and save() writes the
+ * records together with a sorted trigram table whose posting lists are delta-varint
+ * string ids. The file is written to a temporary name and renamed into place.
+ * save() builds the (trigram, id) pairs, eight bytes per text byte, in runs of at most
+ * kRunPairs; full runs are sorted and spilled to temporary files, then merged. Records,
+ * their text and the varint postings stay in memory. If a run cannot be spilled, the
+ * pairs stay buffered instead.
+ * 모든 레코드를 보관하고 save()가 정렬된 트라이그램 표(델타 varint 문자열 id 목록)와 함께 기록합니다.
+ * 파일은 임시 이름으로 쓴 뒤 제자리로 이름을 바꿉니다. 텍스트 바이트당 8바이트인 트라이그램 쌍은
+ * save()가 최대 kRunPairs개씩 만들며, 가득 차면 정렬해 임시 파일로 내보낸 뒤 병합합니다.
+ * 레코드, 텍스트, varint 목록은 메모리에 남습니다. 내보내기에 실패하면 쌍을 계속 버퍼링합니다.
+ */
+class StringIndexWriter : public StringsSink {
+public:
+    static constexpr size_t kRunPairs = size_t(1) << 22; // 32 MB of pairs per run / 실행당 32MB
+
+    void write(const Record& record) override;
+
+    size_t size() const { return m_entries.size(); }
+    bool save(const std::string& path, std::string_view source) const;
+
+private:
+    // On-disk entry layout, also read by StringIndex / 디스크 항목 형식, StringIndex도 사용
+    struct Entry {
+        uint64_t offset;
+        uint64_t vaddr;
+        uint64_t textOffset;
+        uint32_t textLength;
+        uint16_t section;
+        uint8_t encoding;
+        uint8_t hasVaddr;
+    };
+
+    std::vector<Entry> m_entries;
+    std::string m_text;
+    std::vector<std::string> m_sections;
+    std::unordered_map<std::string, uint16_t> m_sectionIds;
+
+    friend class StringIndex;
+};
+
+/**
+ * @brief Read-only view of a .tdx index, memory-mapped / 메모리 매핑된 .tdx 인덱스 읽기 전용 뷰
+ *
+ * Patterns of three or more bytes intersect the posting lists of their trigrams and
+ * only the surviving candidates are compared; shorter patterns scan the stored text.
+ * 3바이트 이상의 패턴은 트라이그램 목록의 교집합 후보만 비교하고, 짧은 패턴은 저장된 텍스트를 훑습니다.
+ */
+class StringIndex {
+public:
+    enum class Match { Substring, Prefix };
+
+    bool open(const std::string& path);
+    bool isOpen() const { return m_open; }
+
+    size_t size() const { return m_stringCount; }
+    std::string_view source() const { return m_source; }
+    StringsSink::Record record(uint32_t id) const;
+
+    // Streams matching records into sink in offset order; returns the match count
+    // 일치하는 레코드를 오프셋 순서로 sink에 전달하고 개수를 반환
+    size_t query(std::string_view pattern, Match mode, StringsSink& sink) const;
+
+private:
+    std::vector<uint32_t> candidates(std::string_view pattern) const;
+    void decodePostings(uint32_t gram, std::vector<uint32_t>& out) const;
+    bool matches(uint32_t id, std::string_view pattern, Match mode) const;
+
+    MappedFile m_map;
+    bool m_open = false;
+    uint64_t m_stringCount = 0;
+    uint64_t m_gramCount = 0;
+    uint64_t m_sectionCount = 0;
+    const unsigned char* m_entries = nullptr;
+    const unsigned char* m_sections = nullptr;
+    const unsigned char* m_grams = nullptr;
+    const unsigned char* m_postings = nullptr;
+    uint64_t m_postingsLength = 0;
+    const char* m_text = nullptr;
+    uint64_t m_textLength = 0;
+    std::string_view m_source;
+};
+
+#endif
@@ -2,44 +2,584 @@
 #define STRINGS_EXTRACTOR_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include "mapped_file.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define STRINGS_EXTRACTOR_X86 1
+#endif
 
 /**
  * @brief Native Strings Extractor / 네이티브 문자열 추출기
  * Rheehose (Rhee Creative) 2008-2026
+ *
+ * The file is memory-mapped and classified 64 bytes at a time (AVX2 when the CPU
+ * has it, SSE2 otherwise, scalar on other targets). Runs of printable ASCII are
+ * reported as (offset, view) spans into the mapping without copying.
+ * Large files are split into chunks scanned by a thread pool; runs crossing a chunk
+ * boundary belong to the chunk they start in, and results are delivered in offset order.
+ * 파일을 메모리 매핑하여 64바이트씩 분류합니다(AVX2, SSE2, 스칼라 순).
+ * 출력 가능한 ASCII 구간은 복사 없이 (오프셋, 뷰)로 전달됩니다.
+ * 큰 파일은 청크로 나누어 스레드 풀에서 처리하며, 경계를 넘는 구간은 시작한 청크가 소유하고
+ * 결과는 오프셋 순서로 전달됩니다.
+ *
+ * forEachHit() additionally finds valid multi-byte UTF-8 and UTF-16LE/BE runs in the
+ * same pass, tagging each hit with its encoding. UTF-16 units are limited to ASCII and
+ * Latin-1 (like `strings -e l`) so random binary data does not read as text.
+ * forEachHit()는 같은 패스에서 유효한 UTF-8 멀티바이트와 UTF-16LE/BE 구간도 찾아 인코딩을 표시합니다.
+ * UTF-16 단위는 임의의 바이너리가 텍스트로 읽히지 않도록 ASCII와 Latin-1로 제한됩니다.
  */
 
 class StringsExtractor {
 public:
-    static std::string extract(const std::string& filePath, int minLength = 4) {
-        std::ifstream file(filePath, std::ios::binary);
-        if (!file.is_open()) return "Error: Cannot open file for strings extraction.";
+    enum Encoding : uint8_t {
+        Ascii = 1,
+        Utf8 = 2,    // Runs containing at least one multi-byte character / 멀티바이트 문자를 포함한 구간
+        Utf16LE = 4,
+        Utf16BE = 8,
+        AllEncodings = Ascii | Utf8 | Utf16LE | Utf16BE
+    };
 
+    struct Hit {
+        uint64_t offset;       // First byte in the file / 파일 내 첫 바이트
+        uint64_t size;         // Bytes in the file / 파일 내 바이트 수
+        Encoding encoding;
+        std::string_view text; // UTF-8, valid during the callback only / UTF-8, 콜백 동안만 유효
+    };
+
+    static const char* encodingName(Encoding encoding) {
+        switch (encoding) {
+            case Utf8: return "utf8";
+            case Utf16LE: return "utf16le";
+            case Utf16BE: return "utf16be";
+            default: return "ascii";
+        }
+    }
+
+    // threads == 0 uses every hardware thread / threads == 0이면 모든 하드웨어 스레드 사용
+    static std::string extract(const std::string& filePath, int minLength = 4, unsigned threads = 0) {
         std::string result;
-        std::string current;
-        unsigned char c;
-
-        while (file.read(reinterpret_cast<char*>(&c), 1)) {
-            // ASCII printable range / ASCII 출력 가능 범위
-            if (c >= 32 && c <= 126) {
-                current += static_cast<char>(c);
-            } else {
-                if (current.length() >= static_cast<size_t>(minLength)) {
-                    result += current + "\n";
+        bool ok = forEachString(filePath, minLength, [&result](uint64_t, std::string_view s) {
+            result.append(s.data(), s.size());
+            result += '\n';
+        }, threads);
+        if (!ok) return "Error: Cannot open file for strings extraction.";
+        return result;
+    }
+
+    /**
+     * Calls fn(offset, text) for every printable run of at least minLength bytes,
+     * in offset order, always on the calling thread. Returns false if the file cannot be opened.
+     * minLength 이상인 출력 가능 구간마다 오프셋 순서로 호출 스레드에서 fn(오프셋, 텍스트)을 호출합니다.
+     */
+    template <typename Fn>
+    static bool forEachString(const std::string& filePath, int minLength, Fn&& fn, unsigned threads = 1) {
+        MappedFile map(filePath);
+        if (map.isOpen()) {
+            map.adviseSequential();
+            scanParallel(map.data(), map.size(), minLength, fn, threads);
+            return true;
+        }
+
+        // Pipes and special files cannot be mapped / 파이프와 특수 파일은 매핑 불가
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) return false;
+        std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        scan(reinterpret_cast<const unsigned char*>(data.data()), data.size(), minLength, fn);
+        return true;
+    }
+
+    /**
+     * Calls fn(hit) for every run of at least minLength characters in any of the requested
+     * encodings, in offset order, on the calling thread. All encodings share one pass.
+     * 요청한 인코딩의 minLength 문자 이상 구간마다 오프셋 순서로 fn(hit)을 호출합니다. 모든 인코딩은 한 패스를 공유합니다.
+     */
+    template <typename Fn>
+    static bool forEachHit(const std::string& filePath, int minLength, unsigned encodings, Fn&& fn,
+                           unsigned threads = 1) {
+        MappedFile map(filePath);
+        if (map.isOpen()) {
+            map.adviseSequential();
+            scanHits(map.data(), map.size(), minLength, encodings, fn, threads);
+            return true;
+        }
+
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) return false;
+        std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        scanHits(reinterpret_cast<const unsigned char*>(data.data()), data.size(), minLength, encodings, fn, 1);
+        return true;
+    }
+
+    template <typename Fn>
+    static void scanHits(const unsigned char* data, size_t size, int minLength, unsigned encodings, Fn&& fn,
+                         unsigned threads) {
+        encodings &= AllEncodings;
+        if (encodings == Ascii) {
+            // Plain ASCII keeps the single-encoding fast path / 순수 ASCII는 단일 인코딩 경로 유지
+            scanParallel(data, size, minLength, [&fn](uint64_t offset, std::string_view s) {
+                fn(Hit{offset, s.size(), Ascii, s});
+            }, threads);
+            return;
+        }
+        if (minLength < 0 || encodings == 0) return;
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        const size_t min = static_cast<size_t>(std::max(1, minLength));
+
+        std::string wide; // UTF-16 hits are converted here / UTF-16 결과 변환 버퍼
+        forEachChunk(size, threads, [&](size_t begin, size_t end, std::vector<Span>& spans) {
+            scanMixed(data, size, begin, end, min, encodings, spans);
+        }, [&](const Span& sp) {
+            Hit hit{sp.offset, sp.length, sp.encoding, view(data, sp.offset, sp.offset + sp.length)};
+            if (sp.encoding == Utf16LE || sp.encoding == Utf16BE) {
+                wide.clear();
+                size_t lo = sp.encoding == Utf16LE ? 0 : 1;
+                for (size_t i = sp.offset; i < sp.offset + sp.length; i += 2) appendLatin1(wide, data[i + lo]);
+                hit.text = wide;
+            }
+            fn(hit);
+        });
+    }
+
+    template <typename Fn>
+    static void scan(const unsigned char* data, size_t size, int minLength, Fn&& fn) {
+        // Negative lengths compare as huge unsigned values and never match
+        // 음수 길이는 큰 부호 없는 값으로 비교되어 일치하지 않음
+        if (minLength < 0) return;
+        if (minLength == 0) {
+            // Every non-printable byte ends a (possibly empty) run / 출력 불가 바이트마다 구간 종료
+            size_t start = 0;
+            for (size_t i = 0; i < size; ++i) {
+                if (!isPrintable(data[i])) {
+                    fn(start, view(data, start, i));
+                    start = i + 1;
+                }
+            }
+            fn(start, view(data, start, size));
+            return;
+        }
+
+        const size_t min = static_cast<size_t>(minLength);
+        bool inRun = false;
+        size_t runStart = 0;
+        auto endRun = [&](size_t end) {
+            if (end - runStart >= min) fn(runStart, view(data, runStart, end));
+            inRun = false;
+        };
+
+        size_t i = 0;
+        MaskFn maskOf = selectKernel();
+        for (; maskOf && i + 64 <= size; i += 64) {
+            uint64_t printable = maskOf(data + i);
+            // Long binary zeros or long text: nothing changes / 상태 변화 없음
+            if (printable == (inRun ? ~0ULL : 0ULL)) continue;
+            size_t pos = 0;
+            while (pos < 64) {
+                uint64_t rest = (inRun ? ~printable : printable) >> pos;
+                if (rest == 0) break;
+                pos += static_cast<size_t>(__builtin_ctzll(rest));
+                if (inRun) {
+                    endRun(i + pos);
+                } else {
+                    runStart = i + pos;
+                    inRun = true;
                 }
-                current.clear();
             }
         }
-        
-        // Final flush / 마지막 플러시
-        if (current.length() >= static_cast<size_t>(minLength)) {
-            result += current + "\n";
+        for (; i < size; ++i) {
+            if (isPrintable(data[i])) {
+                if (!inRun) {
+                    runStart = i;
+                    inRun = true;
+                }
+            } else if (inRun) {
+                endRun(i);
+            }
         }
+        if (inRun) endRun(size);
+    }
 
-        return result;
+    template <typename Fn>
+    static void scanParallel(const unsigned char* data, size_t size, int minLength, Fn&& fn, unsigned threads) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        // Zero-length runs end at every control byte; not worth splitting / 분할할 가치 없음
+        if (threads <= 1 || minLength <= 0 || size < 2 * kMinChunk) {
+            scan(data, size, minLength, fn);
+            return;
+        }
+
+        forEachChunk(size, threads, [&](size_t begin, size_t end, std::vector<Span>& spans) {
+            scanChunk(data, size, begin, end, minLength, spans);
+        }, [&](const Span& sp) {
+            fn(sp.offset, view(data, sp.offset, sp.offset + sp.length));
+        });
+    }
+
+private:
+    struct Span {
+        uint64_t offset;
+        uint64_t length;
+        Encoding encoding;
+    };
+
+    static constexpr size_t kMinChunk = 4 << 20;
+    static constexpr size_t kMaxChunk = 64 << 20;
+
+    /**
+     * Splits [0, size) into chunks, runs scanFn(begin, end, spans) on up to `threads`
+     * workers and delivers the spans chunk by chunk on the calling thread.
+     * [0, size)를 청크로 나누어 최대 threads개 작업자에서 scanFn을 실행하고 호출 스레드에서 청크 순서대로 전달합니다.
+     */
+    template <typename ScanFn, typename DeliverFn>
+    static void forEachChunk(size_t size, unsigned threads, ScanFn&& scanFn, DeliverFn&& deliver) {
+        size_t chunk = std::min(kMaxChunk, std::max(kMinChunk, size / (threads * 4)));
+        size_t count = (size + chunk - 1) / chunk;
+        unsigned workers = static_cast<unsigned>(std::min<size_t>(threads, count));
+        if (workers <= 1) {
+            std::vector<Span> spans;
+            for (size_t c = 0; c < count; ++c) {
+                spans.clear();
+                scanFn(c * chunk, std::min(size, (c + 1) * chunk), spans);
+                for (const Span& sp : spans) deliver(sp);
+            }
+            return;
+        }
+
+        struct Part {
+            std::vector<Span> spans;
+            bool done = false;
+        };
+        std::vector<Part> parts(count);
+        std::atomic<size_t> next{0};
+        std::mutex mutex;
+        std::condition_variable ready;
+
+        auto worker = [&]() {
+            for (size_t c = next++; c < count; c = next++) {
+                std::vector<Span> spans;
+                scanFn(c * chunk, std::min(size, (c + 1) * chunk), spans);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    parts[c].spans = std::move(spans);
+                    parts[c].done = true;
+                }
+                ready.notify_all();
+            }
+        };
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < workers; ++t) pool.emplace_back(worker);
+
+        // Deliver chunk by chunk while later chunks are still being scanned
+        // 뒤쪽 청크를 처리하는 동안 앞 청크부터 순서대로 전달
+        for (size_t c = 0; c < count; ++c) {
+            std::vector<Span> spans;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [&] { return parts[c].done; });
+                spans.swap(parts[c].spans);
+            }
+            for (const Span& sp : spans) deliver(sp);
+        }
+        for (std::thread& t : pool) t.join();
+    }
+
+    // Runs starting in [begin, end); a run crossing end is followed to its real end
+    // [begin, end)에서 시작하는 구간. end를 넘는 구간은 실제 끝까지 따라감
+    static void scanChunk(const unsigned char* data, size_t size, size_t begin, size_t end, int minLength,
+                          std::vector<Span>& spans) {
+        size_t start = begin;
+        if (begin > 0 && isPrintable(data[begin - 1])) {
+            // Tail of a run owned by the previous chunk / 이전 청크가 소유한 구간의 꼬리
+            while (start < end && isPrintable(data[start])) ++start;
+        }
+        if (start >= end) return;
+        size_t stop = end;
+        if (isPrintable(data[end - 1])) {
+            while (stop < size && isPrintable(data[stop])) ++stop;
+        }
+        scan(data + start, stop - start, minLength, [&](uint64_t off, std::string_view s) {
+            spans.push_back(Span{start + off, s.size(), Ascii});
+        });
+    }
+
+    /**
+     * One pass over [begin, end) driving an ASCII/UTF-8 machine and four UTF-16 machines
+     * (little/big endian x even/odd offset). A run is only reported when the character
+     * before it is not text, so a chunk never reports the tail of its predecessor's run,
+     * and the predecessor keeps scanning past end until its own runs close.
+     * [begin, end)를 한 번 순회하며 ASCII/UTF-8 상태기와 UTF-16 상태기 4개(엔디언 x 짝/홀 오프셋)를 구동합니다.
+     * 앞 문자가 텍스트가 아닐 때만 구간을 보고하므로 이전 청크의 꼬리를 중복 보고하지 않습니다.
+     */
+    static void scanMixed(const unsigned char* data, size_t size, size_t begin, size_t end, size_t min,
+                          unsigned encodings, std::vector<Span>& spans) {
+        struct Run {
+            bool active = false;
+            bool multiByte = false;
+            size_t start = 0;
+            size_t stop = 0;
+            size_t count = 0;
+        };
+        const bool textOn = (encodings & (Ascii | Utf8)) != 0;
+        const bool utf8On = (encodings & Utf8) != 0;
+        const bool leOn = (encodings & Utf16LE) != 0;
+        const bool beOn = (encodings & Utf16BE) != 0;
+        Run text;
+        Run units[4]; // [bigEndian * 2 + parity]
+        size_t nextChar = begin;
+
+        auto closeText = [&]() {
+            if (!text.active) return;
+            text.active = false;
+            Encoding enc = text.multiByte ? Utf8 : Ascii;
+            if (text.count >= min && (encodings & enc) && !textEndsAt(data, size, text.start, utf8On)) {
+                spans.push_back(Span{text.start, text.stop - text.start, enc});
+            }
+        };
+        auto closeUnits = [&](Run& run, bool bigEndian) {
+            if (!run.active) return;
+            run.active = false;
+            if (run.count < min) return;
+            if (run.start >= 2 && unitValid(data + run.start - 2, bigEndian)) return;
+            if (shadowed(data, size, run.start, run.count, bigEndian)) return;
+            spans.push_back(Span{run.start, run.count * 2, bigEndian ? Utf16BE : Utf16LE});
+        };
+        auto anyActive = [&]() {
+            return text.active || units[0].active || units[1].active || units[2].active || units[3].active;
+        };
+
+        MaskFn inertOf = selectInertKernel();
+        size_t i = begin;
+        for (; i < size; ++i) {
+            const bool open = i < end; // New runs may only start inside the chunk / 새 구간은 청크 안에서만 시작
+            if (!open && !anyActive()) break;
+
+            // A block of control bytes cannot start any run; the last byte may still be
+            // the high half of a big-endian unit, so step 63 / 제어 바이트 블록은 구간을 시작할 수 없음
+            if (inertOf && open && i + 64 <= end && !anyActive() && inertOf(data + i) == ~0ULL) {
+                i += 62; // The loop adds the 63rd / 루프에서 63번째를 더함
+                continue;
+            }
+
+            if (textOn && i >= nextChar) {
+                size_t len = data[i] < 0x80 ? (isPrintable(data[i]) ? 1 : 0) : (utf8On ? utf8Length(data, size, i) : 0);
+                if (len == 0) {
+                    closeText();
+                    nextChar = i + 1;
+                } else {
+                    if (!text.active && open) {
+                        text.active = true;
+                        text.multiByte = false;
+                        text.start = i;
+                        text.count = 0;
+                    }
+                    if (text.active) {
+                        ++text.count;
+                        text.multiByte |= len > 1;
+                        text.stop = i + len;
+                    }
+                    nextChar = i + len;
+                }
+            }
+
+            if (i + 1 < size) {
+                for (int bigEndian = 0; bigEndian < 2; ++bigEndian) {
+                    if (!(bigEndian ? beOn : leOn)) continue;
+                    Run& run = units[bigEndian * 2 + (i & 1)];
+                    if (unitValid(data + i, bigEndian)) {
+                        if (!run.active && open) {
+                            run.active = true;
+                            run.start = i;
+                            run.count = 0;
+                        }
+                        if (run.active) ++run.count;
+                    } else {
+                        closeUnits(run, bigEndian);
+                    }
+                }
+            }
+        }
+        closeText();
+        for (int k = 0; k < 4; ++k) closeUnits(units[k], k >= 2);
+
+        std::sort(spans.begin(), spans.end(), [](const Span& a, const Span& b) {
+            return a.offset != b.offset ? a.offset < b.offset : a.encoding < b.encoding;
+        });
+    }
+
+    // Printable UTF-16 unit: ASCII or Latin-1 in the low byte / 출력 가능한 UTF-16 단위
+    static bool unitValid(const unsigned char* p, bool bigEndian) {
+        unsigned char hi = bigEndian ? p[0] : p[1];
+        unsigned char lo = bigEndian ? p[1] : p[0];
+        return hi == 0 && (isPrintable(lo) || lo >= 0xA0);
+    }
+
+    // Consecutive valid units from offset, up to limit / offset부터 연속된 유효 단위 수
+    static size_t unitRun(const unsigned char* data, size_t size, size_t offset, bool bigEndian, size_t limit) {
+        size_t count = 0;
+        while (count < limit && offset + 1 < size && unitValid(data + offset, bigEndian)) {
+            ++count;
+            offset += 2;
+        }
+        return count;
+    }
+
+    /**
+     * Every accepted unit has a zero byte, so text in one byte order reads as text in the
+     * other one byte over. Keep the longer reading; ties go to little endian.
+     * 허용된 단위는 모두 0 바이트를 포함하므로 한 바이트 어긋나면 반대 엔디언으로도 읽힙니다.
+     * 더 긴 쪽을 유지하고 같으면 리틀 엔디언을 유지합니다.
+     */
+    static bool shadowed(const unsigned char* data, size_t size, size_t start, size_t count, bool bigEndian) {
+        size_t need = bigEndian ? count : count + 1;
+        size_t before = start > 0 ? unitRun(data, size, start - 1, !bigEndian, need) : 0;
+        size_t after = unitRun(data, size, start + 1, !bigEndian, need);
+        return std::max(before, after) >= need;
+    }
+
+    // Length of a printable multi-byte UTF-8 character at i, or 0 / 출력 가능한 UTF-8 멀티바이트 문자 길이
+    static size_t utf8Length(const unsigned char* data, size_t size, size_t i) {
+        unsigned char c = data[i];
+        size_t len;
+        unsigned char lo = 0x80, hi = 0xBF; // Allowed range of the second byte / 두 번째 바이트 허용 범위
+        if (c >= 0xC2 && c <= 0xDF) {
+            len = 2;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            len = 3;
+            if (c == 0xE0) lo = 0xA0;      // Overlong / 과잉 길이
+            if (c == 0xED) hi = 0x9F;      // Surrogates / 서로게이트
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            len = 4;
+            if (c == 0xF0) lo = 0x90;
+            if (c == 0xF4) hi = 0x8F;      // Above U+10FFFF / U+10FFFF 초과
+        } else {
+            return 0;
+        }
+        if (i + len > size || data[i + 1] < lo || data[i + 1] > hi) return 0;
+        for (size_t k = 2; k < len; ++k) {
+            if ((data[i + k] & 0xC0) != 0x80) return 0;
+        }
+        // C1 controls U+0080..U+009F are not text / C1 제어 문자는 텍스트가 아님
+        if (c == 0xC2 && data[i + 1] < 0xA0) return 0;
+        return len;
+    }
+
+    // Whether a text character ends exactly at offset / offset에서 끝나는 텍스트 문자가 있는지
+    static bool textEndsAt(const unsigned char* data, size_t size, size_t offset, bool utf8) {
+        if (offset == 0) return false;
+        if (isPrintable(data[offset - 1])) return true;
+        if (!utf8) return false;
+        for (size_t k = 2; k <= 4 && k <= offset; ++k) {
+            if (utf8Length(data, size, offset - k) == k) return true;
+        }
+        return false;
+    }
+
+    static void appendLatin1(std::string& out, unsigned char c) {
+        if (c < 0x80) {
+            out += static_cast<char>(c);
+        } else {
+            out += static_cast<char>(0xC0 | (c >> 6));
+            out += static_cast<char>(0x80 | (c & 0x3F));
+        }
+    }
+
+    // Bit i set when byte i of the 64-byte block is printable / 64바이트 블록의 출력 가능 비트마스크
+    using MaskFn = uint64_t (*)(const unsigned char*);
+
+    // ASCII printable range / ASCII 출력 가능 범위
+    static bool isPrintable(unsigned char c) { return c >= 32 && c <= 126; }
+
+    static std::string_view view(const unsigned char* data, size_t begin, size_t end) {
+        return std::string_view(reinterpret_cast<const char*>(data) + begin, end - begin);
+    }
+
+#ifdef STRINGS_EXTRACTOR_X86
+    // Signed compare: bytes >= 0x80 are negative, so "> 31 and != 127" is exactly 32..126
+    // 부호 있는 비교: 0x80 이상은 음수이므로 "> 31 이고 != 127"이 정확히 32..126
+    __attribute__((target("sse2")))
+    static uint64_t maskSse2(const unsigned char* p) {
+        const __m128i lo = _mm_set1_epi8(31), del = _mm_set1_epi8(127);
+        uint64_t mask = 0;
+        for (int k = 0; k < 4; ++k) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + k * 16));
+            __m128i ok = _mm_andnot_si128(_mm_cmpeq_epi8(v, del), _mm_cmpgt_epi8(v, lo));
+            mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(ok))) << (k * 16);
+        }
+        return mask;
+    }
+
+    __attribute__((target("avx2")))
+    static uint64_t maskAvx2(const unsigned char* p) {
+        const __m256i lo = _mm256_set1_epi8(31), del = _mm256_set1_epi8(127);
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+        __m256i okA = _mm256_andnot_si256(_mm256_cmpeq_epi8(a, del), _mm256_cmpgt_epi8(a, lo));
+        __m256i okB = _mm256_andnot_si256(_mm256_cmpeq_epi8(b, del), _mm256_cmpgt_epi8(b, lo));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(okA)) |
+               static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(okB))) << 32;
+    }
+
+    // Bit i set when byte i is a control byte (0..31 or 127) / 제어 바이트(0..31, 127) 비트마스크
+    __attribute__((target("sse2")))
+    static uint64_t inertSse2(const unsigned char* p) {
+        const __m128i top = _mm_set1_epi8(32), del = _mm_set1_epi8(127), neg = _mm_set1_epi8(-1);
+        uint64_t mask = 0;
+        for (int k = 0; k < 4; ++k) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + k * 16));
+            __m128i ctl = _mm_and_si128(_mm_cmpgt_epi8(v, neg), _mm_cmpgt_epi8(top, v));
+            __m128i inert = _mm_or_si128(ctl, _mm_cmpeq_epi8(v, del));
+            mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(inert))) << (k * 16);
+        }
+        return mask;
+    }
+
+    __attribute__((target("avx2")))
+    static uint64_t inertAvx2(const unsigned char* p) {
+        const __m256i top = _mm256_set1_epi8(32), del = _mm256_set1_epi8(127), neg = _mm256_set1_epi8(-1);
+        uint64_t mask = 0;
+        for (int k = 0; k < 2; ++k) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + k * 32));
+            __m256i ctl = _mm256_and_si256(_mm256_cmpgt_epi8(v, neg), _mm256_cmpgt_epi8(top, v));
+            __m256i inert = _mm256_or_si256(ctl, _mm256_cmpeq_epi8(v, del));
+            mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(inert))) << (k * 32);
+        }
+        return mask;
+    }
+
+    static MaskFn selectInertKernel() {
+        static const MaskFn kernel = []() -> MaskFn {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return &inertAvx2;
+            if (__builtin_cpu_supports("sse2")) return &inertSse2;
+            return nullptr;
+        }();
+        return kernel;
+    }
+
+    static MaskFn selectKernel() {
+        static const MaskFn kernel = []() -> MaskFn {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return &maskAvx2;
+            if (__builtin_cpu_supports("sse2")) return &maskSse2;
+            return nullptr;
+        }();
+        return kernel;
     }
+#else
+    static MaskFn selectKernel() { return nullptr; } // Scalar loop only / 스칼라 루프만 사용
+    static MaskFn selectInertKernel() { return nullptr; }
+#endif
 };
 
 #endif // STRINGS_EXTRACTOR_H
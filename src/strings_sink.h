@@ -0,0 +1,288 @@
+#ifndef STRINGS_SINK_H
+#define STRINGS_SINK_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include "strings_extractor.h"
+#include "stream_sink.h"
+#include "binary_info.h"
+
+/**
+ * @brief Section-aware streaming strings output / 섹션 인식 스트리밍 문자열 출력
+ * Rheehose (Rhee Creative) 2008-2026
+ *
+ * Each hit is resolved to its owning section and virtual address and handed to a
+ * StringsSink as soon as it is found, so no full result is ever held in memory.
+ * 각 결과는 소유 섹션과 가상 주소로 변환되어 발견 즉시 StringsSink로 전달되므로
+ * 전체 결과를 메모리에 보관하지 않습니다.
+ */
+
+class StringsSink {
+public:
+    // Instruction referencing a string / 문자열을 참조하는 명령어
+    struct Reference {
+        uint64_t address;
+        std::string_view function; // Empty outside any function / 함수 밖이면 빈 값
+    };
+
+    struct Record {
+        uint64_t offset = 0;
+        uint64_t size = 0;        // Bytes in the file / 파일 내 바이트 수
+        uint64_t vaddr = 0;
+        bool hasVaddr = false;    // Only for loaded sections / 로드되는 섹션만
+        std::string_view section; // Empty outside any section / 섹션 밖이면 빈 값
+        StringsExtractor::Encoding encoding = StringsExtractor::Ascii;
+        std::string_view text;    // Valid during write() only / write() 동안만 유효
+        std::string_view file;    // Source sample for index queries / 인덱스 조회 시 원본 샘플
+        const Reference* refs = nullptr; // Filled by XrefStringsSink / XrefStringsSink가 채움
+        size_t refCount = 0;
+    };
+
+    struct Options {
+        std::string file;
+        int minLength = 4;
+        unsigned encodings = StringsExtractor::Ascii;
+        unsigned threads = 0; // 0 = every hardware thread / 0 = 모든 하드웨어 스레드
+    };
+
+    virtual ~StringsSink() = default;
+    virtual void write(const Record& record) = 0;
+    virtual void flush() {}
+
+    /**
+     * Scans opts.file and streams every hit into sink in offset order, then flushes it.
+     * Returns false if the file cannot be opened.
+     * opts.file을 스캔하여 결과를 오프셋 순서로 sink에 스트리밍한 뒤 비웁니다. 파일을 열 수 없으면 false.
+     */
+    static bool run(const Options& opts, StringsSink& sink);
+};
+
+/**
+ * @brief File offset -> section lookup / 파일 오프셋 -> 섹션 조회
+ * Hits arrive in offset order, so the last match is checked before searching.
+ * 결과가 오프셋 순서로 오므로 마지막 일치 섹션을 먼저 확인합니다.
+ */
+class SectionLocator {
+public:
+    explicit SectionLocator(const std::vector<BinaryInfo::Section>& sections) {
+        for (const BinaryInfo::Section& s : sections) {
+            if (s.hasContents && s.size > 0) m_sections.push_back(&s);
+        }
+        std::stable_sort(m_sections.begin(), m_sections.end(),
+                         [](const BinaryInfo::Section* a, const BinaryInfo::Section* b) { return a->offset < b->offset; });
+    }
+
+    const BinaryInfo::Section* find(uint64_t offset) {
+        if (m_last && contains(*m_last, offset)) return m_last;
+        auto it = std::upper_bound(m_sections.begin(), m_sections.end(), offset,
+                                   [](uint64_t off, const BinaryInfo::Section* s) { return off < s->offset; });
+        // Sections may overlap; walk back over the candidates / 섹션이 겹칠 수 있어 후보를 역순 탐색
+        while (it != m_sections.begin()) {
+            --it;
+            if (contains(**it, offset)) return m_last = *it;
+        }
+        return nullptr;
+    }
+
+private:
+    static bool contains(const BinaryInfo::Section& s, uint64_t offset) {
+        return offset >= s.offset && offset - s.offset < s.size;
+    }
+
+    std::vector<const BinaryInfo::Section*> m_sections;
+    const BinaryInfo::Section* m_last = nullptr;
+};
+
+/**
+ * @brief Text lines: the bare string, or "offset vaddr section encoding text" when tagged.
+ * Records that name their source file are prefixed with "file:", and references follow
+ * the text as "\t<- function@address ...".
+ * 텍스트 행: 문자열만, 또는 태그 모드에서 "오프셋 가상주소 섹션 인코딩 텍스트".
+ * 원본 파일이 있으면 "파일:" 접두사, 참조는 텍스트 뒤에 "\t<- 함수@주소 ..." 형식으로 표시.
+ */
+class TextStringsSink : public StringsSink {
+public:
+    TextStringsSink(OutputSink& out, bool tagged) : m_out(out), m_tagged(tagged) {}
+
+    void write(const Record& r) override {
+        m_line.clear();
+        if (!r.file.empty()) {
+            m_line.append(r.file.data(), r.file.size());
+            m_line += ':';
+        }
+        if (m_tagged) {
+            char prefix[96];
+            char vaddr[24] = "-";
+            if (r.hasVaddr) snprintf(vaddr, sizeof(vaddr), "%08llx", static_cast<unsigned long long>(r.vaddr));
+            std::string section = r.section.empty() ? std::string("-") : std::string(r.section);
+            snprintf(prefix, sizeof(prefix), "%08llx %-8s %-12s %-7s ", static_cast<unsigned long long>(r.offset),
+                     vaddr, section.c_str(), StringsExtractor::encodingName(r.encoding));
+            m_line += prefix;
+        }
+        m_line.append(r.text.data(), r.text.size());
+        if (r.refCount > 0) {
+            m_line += "\t<-";
+            for (size_t k = 0; k < r.refCount; ++k) {
+                char addr[24];
+                snprintf(addr, sizeof(addr), "@%llx", static_cast<unsigned long long>(r.refs[k].address));
+                m_line += ' ';
+                if (r.refs[k].function.empty()) m_line += '?';
+                else m_line.append(r.refs[k].function.data(), r.refs[k].function.size());
+                m_line += addr;
+            }
+        }
+        m_line += '\n';
+        m_out.write(m_line.data(), m_line.size());
+    }
+
+    void flush() override { m_out.flush(); }
+
+private:
+    OutputSink& m_out;
+    bool m_tagged;
+    std::string m_line;
+};
+
+/**
+ * @brief One JSON object per line (NDJSON) / 행마다 JSON 객체 하나 (NDJSON)
+ * {"offset":4660,"vaddr":4198964,"section":".rodata","encoding":"ascii","text":"..."}
+ * vaddr and section are null outside loaded sections. "file" is added for index queries and
+ * "xrefs":[{"address":4457,"function":"main"}] when references were resolved.
+ * 로드되는 섹션 밖에서는 vaddr와 section이 null이며, 인덱스 조회에는 "file", 참조가 있으면 "xrefs"가 추가됨
+ */
+class NdjsonStringsSink : public StringsSink {
+public:
+    explicit NdjsonStringsSink(OutputSink& out) : m_out(out) {}
+
+    void write(const Record& r) override {
+        char num[32];
+        m_line = "{\"offset\":";
+        snprintf(num, sizeof(num), "%llu", static_cast<unsigned long long>(r.offset));
+        m_line += num;
+        m_line += ",\"vaddr\":";
+        if (r.hasVaddr) {
+            snprintf(num, sizeof(num), "%llu", static_cast<unsigned long long>(r.vaddr));
+            m_line += num;
+        } else {
+            m_line += "null";
+        }
+        m_line += ",\"section\":";
+        if (r.section.empty()) {
+            m_line += "null";
+        } else {
+            appendJsonString(m_line, r.section);
+        }
+        m_line += ",\"encoding\":\"";
+        m_line += StringsExtractor::encodingName(r.encoding);
+        m_line += "\",\"text\":";
+        appendJsonString(m_line, r.text);
+        if (!r.file.empty()) {
+            m_line += ",\"file\":";
+            appendJsonString(m_line, r.file);
+        }
+        if (r.refCount > 0) {
+            m_line += ",\"xrefs\":[";
+            for (size_t k = 0; k < r.refCount; ++k) {
+                snprintf(num, sizeof(num), "%llu", static_cast<unsigned long long>(r.refs[k].address));
+                m_line += k ? ",{\"address\":" : "{\"address\":";
+                m_line += num;
+                m_line += ",\"function\":";
+                if (r.refs[k].function.empty()) m_line += "null";
+                else appendJsonString(m_line, r.refs[k].function);
+                m_line += '}';
+            }
+            m_line += ']';
+        }
+        m_line += "}\n";
+        m_out.write(m_line.data(), m_line.size());
+    }
+
+    void flush() override { m_out.flush(); }
+
+    // Appends s as a quoted JSON string / s를 따옴표로 감싼 JSON 문자열로 추가
+    static void appendJsonString(std::string& out, std::string_view s) {
+        out += '"';
+        for (char ch : s) {
+            unsigned char c = static_cast<unsigned char>(ch);
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += ch;
+            } else if (c < 0x20) {
+                char esc[8];
+                snprintf(esc, sizeof(esc), "\\u%04x", c);
+                out += esc;
+            } else {
+                out += ch;
+            }
+        }
+        out += '"';
+    }
+
+private:
+    OutputSink& m_out;
+    std::string m_line;
+};
+
+/**
+ * @brief Forwards only hits inside the named sections / 지정한 섹션 안의 결과만 전달
+ */
+class SectionFilterSink : public StringsSink {
+public:
+    SectionFilterSink(StringsSink& next, std::vector<std::string> sections)
+        : m_next(next), m_sections(std::move(sections)) {}
+
+    void write(const Record& r) override {
+        if (std::find(m_sections.begin(), m_sections.end(), r.section) != m_sections.end()) m_next.write(r);
+    }
+
+    void flush() override { m_next.flush(); }
+
+private:
+    StringsSink& m_next;
+    std::vector<std::string> m_sections;
+};
+
+/**
+ * @brief Fans one record out to several sinks / 하나의 레코드를 여러 싱크로 분배
+ */
+class TeeStringsSink : public StringsSink {
+public:
+    void add(StringsSink* sink) { m_sinks.push_back(sink); }
+
+    void write(const Record& r) override {
+        for (StringsSink* s : m_sinks) s->write(r);
+    }
+
+    void flush() override {
+        for (StringsSink* s : m_sinks) s->flush();
+    }
+
+private:
+    std::vector<StringsSink*> m_sinks;
+};
+
+inline bool StringsSink::run(const Options& opts, StringsSink& sink) {
+    BinaryInfo info = BinaryInfo::load(opts.file);
+    SectionLocator locator(info.sections);
+    Record record;
+    bool ok = StringsExtractor::forEachHit(opts.file, opts.minLength, opts.encodings,
+                                           [&](const StringsExtractor::Hit& hit) {
+        const BinaryInfo::Section* s = locator.find(hit.offset);
+        record.offset = hit.offset;
+        record.size = hit.size;
+        record.section = s ? std::string_view(s->name) : std::string_view();
+        record.hasVaddr = s && s->alloc;
+        record.vaddr = record.hasVaddr ? s->vma + (hit.offset - s->offset) : 0;
+        record.encoding = hit.encoding;
+        record.text = hit.text;
+        sink.write(record);
+    }, opts.threads);
+    sink.flush();
+    return ok;
+}
+
+#endif // STRINGS_SINK_H
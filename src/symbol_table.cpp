@@ -0,0 +1,44 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Symbol Table Implementation - Arena-backed string interner
+ */
+#include "symbol_table.h"
+#include <cstring>
+
+uint32_t SymbolTable::intern(std::string_view name) {
+    auto it = m_ids.find(name);
+    if (it != m_ids.end()) return it->second;
+    uint32_t id = static_cast<uint32_t>(m_names.size());
+    std::string_view stored = store(name);
+    m_names.push_back(stored);
+    m_ids.emplace(stored, id);
+    return id;
+}
+
+uint32_t SymbolTable::find(std::string_view name) const {
+    auto it = m_ids.find(name);
+    return it == m_ids.end() ? npos : it->second;
+}
+
+void SymbolTable::clear() {
+    m_blocks.clear();
+    m_blockUsed = 0;
+    m_blockCapacity = 0;
+    m_names.clear();
+    m_ids.clear();
+}
+
+std::string_view SymbolTable::store(std::string_view name) {
+    if (name.empty()) return std::string_view();
+    if (m_blockUsed + name.size() > m_blockCapacity) {
+        // Oversized names get a block of their own / 큰 이름은 전용 블록 사용
+        size_t capacity = name.size() > kBlockSize ? name.size() : kBlockSize;
+        m_blocks.emplace_back(new char[capacity]);
+        m_blockUsed = 0;
+        m_blockCapacity = capacity;
+    }
+    char* dst = m_blocks.back().get() + m_blockUsed;
+    std::memcpy(dst, name.data(), name.size());
+    m_blockUsed += name.size();
+    return std::string_view(dst, name.size());
+}
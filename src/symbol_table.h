@@ -0,0 +1,50 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Symbol Table Header - Arena-backed string interner with 32-bit ids
+ */
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+
+/**
+ * @brief Interns names once and hands out dense 32-bit ids / 이름을 한 번만 저장하고 32비트 id 발급
+ *
+ * Names are copied into append-only arena blocks, so the views returned by name()
+ * stay valid for the table's lifetime, including across moves. Lookup is hashed.
+ * 이름은 추가 전용 아레나 블록에 복사되므로 name()이 반환한 뷰는 이동 후에도 유효합니다.
+ */
+class SymbolTable {
+public:
+    static constexpr uint32_t npos = 0xffffffffu;
+
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+    SymbolTable(SymbolTable&&) = default;
+    SymbolTable& operator=(SymbolTable&&) = default;
+
+    uint32_t intern(std::string_view name);
+    uint32_t find(std::string_view name) const;
+
+    std::string_view name(uint32_t id) const { return m_names[id]; }
+    size_t size() const { return m_names.size(); }
+    void clear();
+
+private:
+    std::string_view store(std::string_view name);
+
+    static constexpr size_t kBlockSize = 64 * 1024;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    size_t m_blockUsed = 0;
+    size_t m_blockCapacity = 0;
+
+    std::vector<std::string_view> m_names;
+    std::unordered_map<std::string_view, uint32_t> m_ids;
+};
+
+#endif
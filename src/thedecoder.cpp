@@ -8,11 +8,26 @@
 #include <cstdio>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <wordexp.h>
+#include <dirent.h>
+#include <chrono>
+#include <memory>
 #include "visualizer.h"
+#include "listing.h"
 #include "i18n.h"
 #include "strings_extractor.h"
+#include "strings_sink.h"
+#include "string_index.h"
+#include "xref_map.h"
+#include "stream_sink.h"
+#include "disassembler.h"
+#include "binary_info.h"
 #include "python_rev.h"
+#include "analysis.h"
+#include "batch.h"
+#include "result_cache.h"
+#include "progress.h"
 
 // Constants / 상수
 const char* CONFIG_FILE = "~/.thedecoder_rc";
@@ -28,18 +43,25 @@ std::string get_config_path() {
 void load_settings() {
     std::ifstream in(get_config_path());
     if (!in.is_open()) return;
-    std::string key, val;
-    while (in >> key >> val) {
-        if (key == "lang") {
-            if (val == "EN") I18n::instance().setLanguage(Language::EN);
-            else I18n::instance().setLanguage(Language::KO);
-        }
+    std::string line, lang;
+    while (std::getline(in, line)) {
+        size_t space = line.find(' ');
+        if (space == std::string::npos) continue;
+        std::string key = line.substr(0, space), val = line.substr(space + 1);
+        if (key == "lang") lang = val;
+        // Extra language file of "key = text" lines / "키 = 텍스트" 형식의 추가 언어 파일
+        else if (key == "langfile") I18n::instance().loadLanguage(val);
     }
+    if (lang == "EN") I18n::instance().setLanguage(Language::EN);
+    else if (lang == "CUSTOM") I18n::instance().setLanguage(Language::Custom);
+    else I18n::instance().setLanguage(Language::KO);
 }
 
 void save_settings() {
     std::ofstream out(get_config_path());
-    out << "lang " << (I18n::instance().currentLanguage() == Language::EN ? "EN" : "KO") << std::endl;
+    Language lang = I18n::instance().currentLanguage();
+    if (!I18n::instance().customLanguagePath().empty()) out << "langfile " << I18n::instance().customLanguagePath() << std::endl;
+    out << "lang " << (lang == Language::EN ? "EN" : lang == Language::Custom ? "CUSTOM" : "KO") << std::endl;
 }
 
 /**
@@ -60,23 +82,35 @@ void print_logo() {
     std::cout << " | |_| | | |  __/ (_| |  __/ (_| (_) | (_| |  __/ |   \n";
     std::cout << "  \\__|_| |_|\\___|\\__,_|\\___|\\__\\___/ \\__,_|\\___|_|   \n";
     std::cout << "\033[0m";
-    std::cout << "         --- " << I18n::instance().get("app_title") << " ---\n";
+    std::cout << "         --- " << I18n::instance().get(Msg::AppTitle) << " ---\n";
     std::cout << "         --- Beyond Perfection, Monster Grade ---\n\n";
 }
 
 int main(int argc, char** argv) {
     load_settings();
     std::string infile;
-    std::string outfile = "output.asm";
+    std::string outfile; // Default output.asm, or the batch directory / 기본값 output.asm 또는 배치 디렉터리
     bool intel = false;
     bool graph = false;
+    std::string exportfile;
+    int jobs = 0; // 0 = not given: serial objdump, all cores for /strings / 미지정: objdump 직렬, /strings 전체 코어
+    bool unicode = false; // /strings: every encoding, tagged / 모든 인코딩, 태그 표시
+    bool json = false;    // /strings: NDJSON records / NDJSON 레코드
+    std::vector<std::string> sections; // /strings: section filter / 섹션 필터
+    std::string indexfile; // /strings: trigram index to write / 기록할 트라이그램 인덱스
+    bool prefix = false;   // /query: prefix instead of substring / 부분 문자열 대신 접두사
+    bool xrefs = false;    // /strings: resolve referencing instructions / 참조 명령어 해석
+    std::string batchsource; // --batch: directory or list file / 디렉터리 또는 목록 파일
+    bool batchstrings = false; // --batch: also extract strings / 문자열도 추출
+    bool usecache = true;  // Serve and store results in ~/.cache/thedecoder / 결과 캐시 사용
+    int progressfd = -1;   // JSON progress events, e.g. 3 / JSON 진행 이벤트 (예: 3)
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         if (arg == "/lang") {
             I18n::instance().toggleLanguage();
             save_settings();
-            std::cout << "Language changed / 언어 변경됨: " << I18n::instance().get("lang_toggle") << std::endl;
+            std::cout << "Language changed / 언어 변경됨: " << I18n::instance().get(Msg::LangToggle) << std::endl;
             if (argc == 2) return 0; // Just toggling / 그냥 전환만 함
             continue;
         }
@@ -88,10 +122,121 @@ int main(int argc, char** argv) {
         }
         
         if (arg == "/strings" && i + 1 < argc) {
-            std::string target = argv[++i];
-            std::cout << "Extracting strings from: " << target << std::endl;
-            std::cout << StringsExtractor::extract(target) << std::endl;
-            return 0;
+            StringsSink::Options sopts;
+            sopts.file = argv[++i];
+            sopts.encodings = unicode ? StringsExtractor::AllEncodings : StringsExtractor::Ascii;
+            sopts.threads = static_cast<unsigned>(jobs);
+            // NDJSON consumers read stdout, so the banner goes to stderr / NDJSON 소비자를 위해 안내는 stderr로
+            (json ? std::cerr : std::cout) << "Extracting strings from: " << sopts.file << std::endl;
+
+            // A cached result replaces both the scan and the --xrefs disassembly; --index needs live records
+            // 캐시된 결과는 스캔과 --xrefs 역어셈블을 모두 대체하며, --index는 실제 레코드가 필요
+            ResultCache cache(usecache && indexfile.empty() ? ResultCache::defaultDirectory() : std::string());
+            std::string key;
+            uint64_t content;
+            if (cache.isEnabled() && ResultCache::hashFile(sopts.file, content)) {
+                std::string spec = ResultCache::stringsOptions(sopts.minLength, sopts.encodings, json, unicode);
+                if (xrefs) spec += " xrefs=1";
+                for (const std::string& s : sections) spec += " section=" + s;
+                key = ResultCache::key(content, "strings", spec);
+                std::string cached = cache.lookup(key);
+                FileSink out(STDOUT_FILENO);
+                if (!cached.empty() && ResultCache::stream(cached, out)) {
+                    out.close();
+                    return out.good() ? 0 : 1;
+                }
+            }
+
+            // Data references from the disassembly, sorted by target once
+            // 디스어셈블리의 데이터 참조를 대상 주소로 한 번 정렬
+            XrefMap xrefMap;
+            if (xrefs) {
+                LineSink records([&](std::string_view line) { xrefMap.addRecord(Listing::parseLine(line)); });
+                Disassembler::Options dopts;
+                dopts.file = sopts.file;
+                dopts.jobs = jobs;
+                // Partial references would silently miss strings / 일부 참조만으로는 문자열을 조용히 놓침
+                if (int code = Disassembler::run(dopts, records)) {
+                    std::cerr << Analysis::objdumpError(code) << std::endl;
+                    return 1;
+                }
+                xrefMap.finalize();
+            }
+
+            // Results stream to stdout as they are found / 결과는 발견 즉시 stdout으로 스트리밍
+            FileSink out(STDOUT_FILENO);
+            TeeSink outputs;
+            outputs.add(&out);
+            std::unique_ptr<ResultCache::Writer> store;
+            if (!key.empty()) {
+                store = std::make_unique<ResultCache::Writer>(cache, key);
+                outputs.add(store.get());
+            }
+            TextStringsSink text(outputs, unicode);
+            NdjsonStringsSink ndjson(outputs);
+            StringIndexWriter index;
+            TeeStringsSink tee;
+            tee.add(json ? static_cast<StringsSink*>(&ndjson) : &text);
+            if (!indexfile.empty()) tee.add(&index);
+            // run -> section filter -> xrefs -> output and index / 실행 -> 섹션 필터 -> 참조 -> 출력, 인덱스
+            StringsSink* head = &tee;
+            XrefStringsSink withRefs(xrefMap, *head);
+            if (xrefs) head = &withRefs;
+            SectionFilterSink filtered(*head, sections);
+            if (!sections.empty()) head = &filtered;
+            if (!StringsSink::run(sopts, *head)) {
+                std::cerr << "Error: Cannot open file for strings extraction." << std::endl;
+                return 1;
+            }
+            if (store) store->commit();
+            out.close();
+            if (!indexfile.empty() && !index.save(indexfile, sopts.file)) {
+                std::cerr << I18n::instance().get(Msg::OutputFileFailed) << ": " << indexfile << std::endl;
+                return 1;
+            }
+            return out.good() ? 0 : 1;
+        }
+
+        if (arg == "/query" && i + 2 < argc) {
+            std::string pattern = argv[++i];
+            // Remaining arguments are .tdx files or directories of them / 나머지 인자는 .tdx 파일 또는 디렉터리
+            std::vector<std::string> indexes;
+            for (++i; i < argc; ++i) {
+                std::string path = clean_path(argv[i]);
+                DIR* dir = opendir(path.c_str());
+                if (!dir) {
+                    indexes.push_back(path);
+                    continue;
+                }
+                std::vector<std::string> found;
+                while (dirent* ent = readdir(dir)) {
+                    std::string name = ent->d_name;
+                    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".tdx") == 0) found.push_back(path + "/" + name);
+                }
+                closedir(dir);
+                std::sort(found.begin(), found.end());
+                indexes.insert(indexes.end(), found.begin(), found.end());
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            FileSink out(STDOUT_FILENO);
+            TextStringsSink text(out, true);
+            NdjsonStringsSink ndjson(out);
+            StringsSink& format = json ? static_cast<StringsSink&>(ndjson) : text;
+            size_t matches = 0;
+            for (const std::string& path : indexes) {
+                StringIndex index;
+                if (!index.open(path)) {
+                    std::cerr << "Error: Not a strings index: " << path << std::endl;
+                    continue;
+                }
+                matches += index.query(pattern, prefix ? StringIndex::Match::Prefix : StringIndex::Match::Substring, format);
+            }
+            format.flush();
+            out.close();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::cerr << matches << " matches in " << indexes.size() << " index(es), " << ms << " ms" << std::endl;
+            return out.good() ? 0 : 1;
         }
 
         if (arg == "/py" && i + 1 < argc) {
@@ -102,17 +247,57 @@ int main(int argc, char** argv) {
         }
 
         if (arg == "-h" || arg == "--help") {
-            std::cout << I18n::instance().get("cli_usage") << std::endl;
+            std::cout << I18n::instance().get(Msg::CliUsage) << std::endl;
             std::cout << "Options:" << std::endl;
             std::cout << "  -o <file>   Output filename" << std::endl;
             std::cout << "  --intel     Use Intel syntax" << std::endl;
             std::cout << "  --graph     Generate Mermaid CFG" << std::endl;
+            std::cout << "  -j <n>      Parallel disassembly / strings with n workers" << std::endl;
+            std::cout << "  --export <f> Export instruction records as TSV" << std::endl;
+            std::cout << "  --unicode   /strings: also UTF-8/UTF-16, tagged with offset, section and encoding" << std::endl;
+            std::cout << "  --json      /strings: one NDJSON record per string" << std::endl;
+            std::cout << "  --section <s> /strings: only strings in section s (repeatable)" << std::endl;
+            std::cout << "  --index <f> /strings: also write a trigram index for /query" << std::endl;
+            std::cout << "  --xrefs     /strings: list instructions and functions referencing each string" << std::endl;
+            std::cout << "  --batch <dir|list> Analyze every file with -j workers; -o names the output directory" << std::endl;
+            std::cout << "  --progress-fd <n> Write JSON progress events to descriptor n (e.g. 3)" << std::endl;
+            std::cout << "  --no-cache  Ignore and do not update the result cache (~/.cache/thedecoder)" << std::endl;
+            std::cout << "  --strings   --batch: also write <name>.strings (honors --unicode/--json)" << std::endl;
+            std::cout << "  /query <pattern> <index|dir>... Substring search over indexes (--prefix for prefixes)" << std::endl;
             std::cout << "  /strings <f> Extract strings from file" << std::endl;
             std::cout << "  /py <file>  Python reversing (PyInstaller)" << std::endl;
-            std::cout << "  /lang       " << I18n::instance().get("cli_lang_cmd") << std::endl;
+            std::cout << "  /lang       " << I18n::instance().get(Msg::CliLangCmd) << std::endl;
             return 0;
         } else if (arg == "-o" && i + 1 < argc) {
             outfile = clean_path(argv[++i]);
+        } else if (arg == "-j" && i + 1 < argc) {
+            jobs = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--export" && i + 1 < argc) {
+            exportfile = clean_path(argv[++i]);
+        } else if (arg == "--unicode") {
+            unicode = true;
+        } else if (arg == "--json") {
+            json = true;
+        } else if (arg == "--index" && i + 1 < argc) {
+            indexfile = clean_path(argv[++i]);
+        } else if (arg == "--prefix") {
+            prefix = true;
+        } else if (arg == "--xrefs") {
+            xrefs = true;
+        } else if (arg == "--batch" && i + 1 < argc) {
+            batchsource = clean_path(argv[++i]);
+        } else if (arg == "--strings") {
+            batchstrings = true;
+        } else if (arg == "--no-cache") {
+            usecache = false;
+        } else if (arg == "--progress-fd" && i + 1 < argc) {
+            progressfd = std::atoi(argv[++i]);
+            if (progressfd < 0 || fcntl(progressfd, F_GETFD) == -1) {
+                std::cerr << "Warning: progress descriptor " << argv[i] << " is not open; ignoring." << std::endl;
+                progressfd = -1;
+            }
+        } else if (arg == "--section" && i + 1 < argc) {
+            sections.push_back(argv[++i]);
         } else if (arg == "--intel") {
             intel = true;
         } else if (arg == "--graph") {
@@ -122,63 +307,132 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (!batchsource.empty()) {
+        std::vector<std::string> inputs = Batch::collectInputs(batchsource);
+        if (inputs.empty()) {
+            std::cerr << I18n::instance().get(Msg::FileNotFound) << ": " << batchsource << std::endl;
+            return 1;
+        }
+        Batch::Options bopts;
+        if (!outfile.empty()) bopts.outDir = outfile;
+        bopts.intel = intel;
+        bopts.graph = graph;
+        bopts.strings = batchstrings;
+        bopts.json = json;
+        bopts.unicode = unicode;
+        bopts.workers = static_cast<unsigned>(jobs);
+        ResultCache cache(usecache ? ResultCache::defaultDirectory() : std::string());
+        if (cache.isEnabled()) bopts.cache = &cache;
+
+        print_logo();
+        std::cout << "[*] Batch: " << inputs.size() << " input(s) -> " << bopts.outDir << "/\n";
+        auto start = std::chrono::steady_clock::now();
+        std::vector<Batch::Result> results = Batch::run(inputs, bopts, [progressfd](const Batch::Result& r, size_t done, size_t total) {
+            std::cout << "[" << done << "/" << total << "] " << (r.ok ? "\033[1;32mok\033[0m     " : "\033[1;31mfailed\033[0m ")
+                      << r.input << " (" << r.seconds << " s" << (r.cached ? ", cached)" : ")");
+            if (!r.ok) std::cout << ": " << r.error;
+            std::cout << std::endl;
+
+            std::string fields = "\"done\":" + std::to_string(done) + ",\"total\":" + std::to_string(total) + ",\"input\":";
+            NdjsonStringsSink::appendJsonString(fields, r.input);
+            fields += std::string(",\"status\":\"") + (r.ok ? "ok" : "failed") + "\",\"cached\":" + (r.cached ? "true" : "false");
+            fields += ",\"seconds\":" + std::to_string(r.seconds) + ",\"listing_bytes\":" + std::to_string(r.listingBytes);
+            if (!r.ok) {
+                fields += ",\"error\":";
+                NdjsonStringsSink::appendJsonString(fields, r.error);
+            }
+            ProgressRenderer::writeEvent(progressfd, "file", fields);
+        });
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::string summaryfile = bopts.outDir + "/summary.tsv";
+        std::ofstream summary(summaryfile);
+        Batch::writeSummary(summary, results);
+        summary.close();
+
+        size_t failed = std::count_if(results.begin(), results.end(), [](const Batch::Result& r) { return !r.ok; });
+        long long bytes = 0;
+        for (const Batch::Result& r : results) bytes += r.listingBytes;
+        ProgressRenderer::writeEvent(progressfd, "done", "\"ok\":" + std::to_string(results.size() - failed) + ",\"failed\":" +
+                                              std::to_string(failed) + ",\"seconds\":" + std::to_string(seconds));
+        std::cout << "\n[*] " << (results.size() - failed) << " ok, " << failed << " failed, " << (bytes / 1024)
+                  << " KB of listings in " << seconds << " s\n";
+        if (summary) std::cout << "[*] " << I18n::instance().get(Msg::SavedTo) << summaryfile << std::endl;
+        else std::cerr << I18n::instance().get(Msg::OutputFileFailed) << ": " << summaryfile << std::endl;
+        return failed == 0 && summary ? 0 : 1;
+    }
+    if (outfile.empty()) outfile = "output.asm";
+
     if (infile.empty()) {
-        std::cout << I18n::instance().get("cli_usage") << std::endl;
+        std::cout << I18n::instance().get(Msg::CliUsage) << std::endl;
         std::cout << "Try 'thedecoder --help' for more information." << std::endl;
         return 1;
     }
 
     struct stat st;
     if (stat(infile.c_str(), &st) != 0) {
-        std::cerr << I18n::instance().get("file_not_found") << ": " << infile << std::endl;
+        std::cerr << I18n::instance().get(Msg::FileNotFound) << ": " << infile << std::endl;
         return 1;
     }
     long total_size = st.st_size;
 
     print_logo();
-    std::cout << I18n::instance().get("analyzing") << ": " << infile << " (" << (total_size / 1024) << " KB)\n";
+    std::cout << I18n::instance().get(Msg::Analyzing) << ": " << infile << " (" << (total_size / 1024) << " KB)\n";
 
-    std::string cmd = "objdump -d ";
-    if (intel) cmd += "-Mintel ";
-    cmd += infile;
+    Analysis::Options aopts;
+    aopts.infile = infile;
+    aopts.outfile = outfile;
+    aopts.exportfile = exportfile;
+    aopts.intel = intel;
+    aopts.graph = graph;
+    aopts.jobs = jobs;
+    ResultCache cache(usecache ? ResultCache::defaultDirectory() : std::string());
+    if (cache.isEnabled()) aopts.cache = &cache;
+    Analysis analysis(aopts);
 
-    FILE* pipe = popen(cmd.c_str(), "r");
-    if (!pipe) {
-        std::cerr << I18n::instance().get("objdump_fail") << std::endl;
-        return 1;
+    // Native header sniffing / 네이티브 헤더 탐지
+    const BinaryInfo& info = analysis.info();
+    if (info.format != BinaryInfo::Format::Unknown) {
+        char entry[32];
+        snprintf(entry, sizeof(entry), "0x%llx", static_cast<unsigned long long>(info.entry));
+        std::cout << I18n::instance().get(Msg::Architecture) << ": " << info.arch << " (" << info.formatName() << ", "
+                  << (info.bigEndian ? "big" : "little") << "-endian, entry " << entry << ")\n";
     }
 
-    std::string pipe_output_buffer;
-    char buffer[4096];
-    long processed = 0;
-    while (fgets(buffer, sizeof(buffer), pipe) != NULL) {
-        std::string line(buffer);
-        pipe_output_buffer += line;
-        processed += line.size();
-        
-        int progress = (int)((float)processed / (total_size * 5) * 100); 
-        if (progress > 100) progress = 100;
-        
-        std::cout << "\r" << I18n::instance().get("disassembling") << "... [" << progress << "%] " << std::flush;
+    // The reader only updates counters; a separate thread redraws the line 10 times a second
+    // 읽는 쪽은 카운터만 갱신하고 별도 스레드가 초당 10회 행을 다시 그림
+    std::cout << std::flush;
+    ProgressRenderer renderer(analysis.progress(), std::string(I18n::instance().get(Msg::Disassembling)), progressfd);
+    renderer.start();
+    bool ran = analysis.disassemble();
+    renderer.stop();
+    ProgressRenderer::writeEvent(progressfd, "done", std::string("\"status\":\"") + (ran ? "ok" : "failed") + "\"," +
+                                                         analysis.progress().snapshot().jsonFields());
+    if (!ran) {
+        std::cerr << analysis.error() << std::endl;
+        return 1;
     }
-    pclose(pipe);
-    std::cout << "\n";
-
-    std::ofstream out(outfile);
-    out << pipe_output_buffer;
-    out.close();
+    if (analysis.listingFromCache()) std::cout << "[*] Served from cache: " << cache.directory() << "\n";
 
     if (graph) {
-        std::cout << "[*] " << I18n::instance().get("visualizing") << "...\n";
-        std::string mermaid = Visualizer::generateMermaidCFG(pipe_output_buffer);
-        std::ofstream gout(outfile + ".mermaid");
-        gout << mermaid;
-        gout.close();
-        std::cout << "[+] " << I18n::instance().get("finished") << ": " << outfile << ".mermaid\n";
+        std::cout << "[*] " << I18n::instance().get(Msg::Visualizing) << "...\n";
+        if (!analysis.writeGraph()) {
+            std::cerr << analysis.error() << std::endl;
+            return 1;
+        }
+        std::cout << "[+] " << I18n::instance().get(Msg::Finished) << ": " << outfile << ".mermaid\n";
+    }
+
+    if (!exportfile.empty()) {
+        if (!analysis.writeExport()) {
+            std::cerr << analysis.error() << std::endl;
+            return 1;
+        }
+        std::cout << "[+] " << I18n::instance().get(Msg::Finished) << ": " << exportfile << "\n";
     }
 
-    std::cout << "\033[1;32m[+] " << I18n::instance().get("finished") << ": " << outfile << "\033[0m\n";
-    std::cout << "[*] " << I18n::instance().get("saved_to") << outfile << std::endl;
+    std::cout << "\033[1;32m[+] " << I18n::instance().get(Msg::Finished) << ": " << outfile << "\033[0m\n";
+    std::cout << "[*] " << I18n::instance().get(Msg::SavedTo) << outfile << std::endl;
 
     return 0;
 }
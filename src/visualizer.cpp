@@ -1,63 +1,74 @@
 /*
  * (C) Rheehose (Rhee Creative) 2008-2026
- * Assembly Visualizer Implementation - Parses objdump output
+ * Assembly Visualizer Implementation - Renders a ControlFlowGraph as Mermaid
  */
 #include "visualizer.h"
-#include <sstream>
-#include <regex>
-#include <iostream>
+#include <cstdio>
+#include <string_view>
 
-std::string Visualizer::generateMermaidCFG(const std::string& asmText) {
-    std::stringstream ss(asmText);
-    std::string line;
-    std::string currentFunction = "unknown";
-    std::set<Edge> edges;
-    std::set<std::string> functions;
+namespace {
+// Mermaid label text; double quotes would end the label / 큰따옴표는 레이블을 끝내므로 치환
+void appendLabel(std::string& out, std::string_view text) {
+    for (char c : text) {
+        if (c == '"') out += "#quot;";
+        else out += c;
+    }
+}
 
-    // Regex for function headers: 0000000000001000 <main>:
-    std::regex funcRegex(R"([0-9a-fA-F]+\s+<([^>]+)>:)");
-    // Regex for jump/call targets: e8 abcdef00  call 2000 <foo> or eb 10 jmp 1027 <main+0x27>
-    std::regex targetRegex(R"(<([^>+]+)(?:\+0x[0-9a-fA-F]+)?>)");
+void appendHex(std::string& out, uint64_t v) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), "0x%llx", static_cast<unsigned long long>(v));
+    out += buf;
+}
+}
 
-    while (std::getline(ss, line)) {
-        std::smatch match;
-        if (std::regex_search(line, match, funcRegex)) {
-            currentFunction = match[1].str();
-            functions.insert(currentFunction);
-        } else if (currentFunction != "unknown") {
-            // Check for jumps and calls
-            if (line.find("call") != std::string::npos || 
-                line.find("jmp") != std::string::npos ||
-                line.find("j") == line.find_first_of("j") && line.find("j") != std::string::npos) {
-                
-                std::string::const_iterator searchStart(line.c_str());
-                while (std::regex_search(searchStart, line.cend(), match, targetRegex)) {
-                    std::string target = match[1].str();
-                    if (target != currentFunction) {
-                        Edge e;
-                        e.from = currentFunction;
-                        e.to = target;
-                        if (line.find("call") != std::string::npos) e.label = "calls";
-                        else e.label = "jumps to";
-                        edges.insert(e);
-                    }
-                    searchStart = match[0].second;
-                }
-            }
+std::string Visualizer::renderMermaid(const ControlFlowGraph& graph, const std::atomic<bool>* cancel) {
+    // Checked once per function and per block, which bounds the wasted work / 함수와 블록마다 확인
+    auto cancelled = [cancel]() { return cancel && cancel->load(std::memory_order_relaxed); };
+    std::string out = "graph TD\n";
+    out += "  %% Monster Grade Analysis / (C) Rheehose 2008-2026\n";
+
+    for (uint32_t fn = 0; fn < graph.functionCount(); ++fn) {
+        if (cancelled()) return std::string();
+        uint32_t begin = graph.functionBlockBegin(fn), end = graph.functionBlockEnd(fn);
+        if (begin == end) continue;
+        out += "  subgraph f" + std::to_string(fn) + " [\"";
+        appendLabel(out, graph.functionName(fn));
+        out += "\"]\n";
+        for (uint32_t b = begin; b < end; ++b) {
+            out += "    b" + std::to_string(b) + "[\"";
+            appendHex(out, graph.blockAddress(b));
+            out += " (" + std::to_string(graph.blockInstructions(b)) + ")\"]\n";
         }
+        out += "  end\n";
     }
 
-    std::stringstream mermaid;
-    mermaid << "graph TD\n";
-    mermaid << "  %% Monster Grade Analysis / (C) Rheehose 2008-2026\n";
-    
-    for (const auto& func : functions) {
-        mermaid << "  " << func << "[" << func << "]\n";
+    // Targets outside the listing become plain symbol nodes / 목록 밖의 대상은 심볼 노드로 표시
+    std::vector<uint8_t> external(graph.symbolCount(), 0);
+    for (uint32_t e = 0; e < graph.edgeCount(); ++e) {
+        uint32_t sym = graph.edgeSymbol(e);
+        if (graph.edgeTarget(e) != ControlFlowGraph::npos || external[sym]) continue;
+        external[sym] = 1;
+        out += "  x" + std::to_string(sym) + "[\"";
+        appendLabel(out, graph.symbolName(sym));
+        out += "\"]\n";
     }
 
-    for (const auto& edge : edges) {
-        mermaid << "  " << edge.from << " -- " << edge.label << " --> " << edge.to << "\n";
+    for (uint32_t b = 0; b < graph.blockCount(); ++b) {
+        if (cancelled()) return std::string();
+        for (uint32_t e = graph.edgeBegin(b); e < graph.edgeEnd(b); ++e) {
+            uint32_t target = graph.edgeTarget(e);
+            std::string to = target == ControlFlowGraph::npos ? "x" + std::to_string(graph.edgeSymbol(e))
+                                                               : "b" + std::to_string(target);
+            out += "  b" + std::to_string(b);
+            switch (graph.edgeKind(e)) {
+                case ControlFlowGraph::EdgeKind::Fallthrough: out += " --> "; break;
+                case ControlFlowGraph::EdgeKind::Jump: out += " -- jumps to --> "; break;
+                case ControlFlowGraph::EdgeKind::Taken: out += " -- taken --> "; break;
+                case ControlFlowGraph::EdgeKind::Call: out += " -. calls .-> "; break;
+            }
+            out += to + "\n";
+        }
     }
-
-    return mermaid.str();
+    return out;
 }
@@ -5,30 +5,15 @@
 #ifndef VISUALIZER_H
 #define VISUALIZER_H
 
+#include <atomic>
 #include <string>
-#include <vector>
-#include <set>
-#include <map>
+#include "control_flow.h"
 
 class Visualizer {
 public:
-    /**
-     * Generates a Mermaid.js string representing the Control Flow Graph (CFG)
-     * of the provided assembly text.
-     */
-    static std::string generateMermaidCFG(const std::string& asmText);
-
-private:
-    struct Edge {
-        std::string from;
-        std::string to;
-        std::string label;
-        bool operator<(const Edge& other) const {
-            if (from != other.from) return from < other.from;
-            if (to != other.to) return to < other.to;
-            return label < other.label;
-        }
-    };
+    // Mermaid renderer for the basic-block engine; returns "" once cancel is set
+    // 기본 블록 엔진용 Mermaid 렌더러, cancel이 설정되면 "" 반환
+    static std::string renderMermaid(const ControlFlowGraph& graph, const std::atomic<bool>* cancel = nullptr);
 };
 
 #endif
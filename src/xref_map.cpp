@@ -0,0 +1,48 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Cross-Reference Map Implementation - Sorted reference table and string join
+ */
+#include "xref_map.h"
+#include <algorithm>
+
+namespace {
+constexpr uint8_t kBranch = Listing::Call | Listing::Jump | Listing::CondJump;
+}
+
+void XrefMap::addRecord(const Listing::Fields& f) {
+    if (f.kind == Listing::Kind::Function) {
+        m_currentFunction = m_functions.intern(f.name);
+    } else if (f.kind == Listing::Kind::Instruction && f.hasReference && !(f.flags & kBranch)) {
+        // Branch targets are code, not data / 분기 대상은 데이터가 아닌 코드
+        m_refs.push_back(Ref{f.reference, f.address, m_currentFunction});
+    }
+}
+
+void XrefMap::finalize() {
+    std::sort(m_refs.begin(), m_refs.end(), [](const Ref& a, const Ref& b) {
+        return a.target != b.target ? a.target < b.target : a.address < b.address;
+    });
+}
+
+std::pair<const XrefMap::Ref*, const XrefMap::Ref*> XrefMap::referencesTo(uint64_t begin, uint64_t end) const {
+    auto byTarget = [](const Ref& r, uint64_t addr) { return r.target < addr; };
+    const Ref* first = std::lower_bound(m_refs.data(), m_refs.data() + m_refs.size(), begin, byTarget);
+    const Ref* last = std::lower_bound(first, m_refs.data() + m_refs.size(), end, byTarget);
+    return {first, last};
+}
+
+void XrefStringsSink::write(const Record& record) {
+    m_refs.clear();
+    if (record.hasVaddr) {
+        // Any address inside the string counts, e.g. a pointer to its middle
+        // 문자열 내부 주소도 참조로 간주 (예: 중간을 가리키는 포인터)
+        auto range = m_map.referencesTo(record.vaddr, record.vaddr + std::max<uint64_t>(record.size, 1));
+        for (const XrefMap::Ref* r = range.first; r != range.second; ++r) {
+            m_refs.push_back(Reference{r->address, m_map.functionName(r->function)});
+        }
+    }
+    Record out = record;
+    out.refs = m_refs.data();
+    out.refCount = m_refs.size();
+    m_next.write(out);
+}
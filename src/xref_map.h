@@ -0,0 +1,66 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Cross-Reference Map Header - Data references from code, sorted by target address
+ */
+#ifndef XREF_MAP_H
+#define XREF_MAP_H
+
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "listing.h"
+#include "symbol_table.h"
+#include "strings_sink.h"
+
+/**
+ * @brief Instructions that reference data, keyed by the referenced address
+ * 데이터를 참조하는 명령어를 참조 주소 기준으로 보관
+ *
+ * Records are fed in listing order; finalize() sorts the references once so every
+ * range lookup is a binary search.
+ * 레코드를 목록 순서로 입력하고 finalize()가 한 번 정렬하므로 범위 조회는 이진 탐색입니다.
+ */
+class XrefMap {
+public:
+    static constexpr uint32_t npos = 0xffffffffu;
+
+    struct Ref {
+        uint64_t target;   // Referenced address / 참조된 주소
+        uint64_t address;  // Referencing instruction / 참조하는 명령어
+        uint32_t function; // npos outside any function / 함수 밖이면 npos
+    };
+
+    void addRecord(const Listing::Fields& fields);
+    void finalize();
+
+    size_t size() const { return m_refs.size(); }
+    std::string_view functionName(uint32_t fn) const { return fn == npos ? std::string_view() : m_functions.name(fn); }
+
+    // References whose target lies in [begin, end), by target then address
+    // 대상이 [begin, end)에 있는 참조, 대상과 주소 순
+    std::pair<const Ref*, const Ref*> referencesTo(uint64_t begin, uint64_t end) const;
+
+private:
+    std::vector<Ref> m_refs;
+    SymbolTable m_functions;
+    uint32_t m_currentFunction = npos;
+};
+
+/**
+ * @brief Attaches referencing instructions to each string record / 문자열 레코드에 참조 명령어 첨부
+ */
+class XrefStringsSink : public StringsSink {
+public:
+    XrefStringsSink(const XrefMap& map, StringsSink& next) : m_map(map), m_next(next) {}
+
+    void write(const Record& record) override;
+    void flush() override { m_next.flush(); }
+
+private:
+    const XrefMap& m_map;
+    StringsSink& m_next;
+    std::vector<Reference> m_refs;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * (C) Rheehose (Rhee Creative) 2008-2026
+ * Listing Test - Mnemonic classification across x86, ARM32, AArch64 and MIPS lines
+ */
+#include "../src/listing.h"
+#include <iostream>
+
+namespace {
+int failures = 0;
+
+void expect(const char* line, uint8_t flags, const char* mnemonic) {
+    Listing::Fields f = Listing::parseLine(line);
+    std::string_view text(line);
+    std::string_view m = f.mnemonicOff == Listing::noSpan ? std::string_view() : text.substr(f.mnemonicOff, f.mnemonicLen);
+    if (f.kind != Listing::Kind::Instruction || f.flags != flags || m != mnemonic) {
+        std::cout << "FAIL: \"" << line << "\": mnemonic \"" << m << "\" flags " << int(f.flags)
+                  << ", expected \"" << mnemonic << "\" flags " << int(flags) << std::endl;
+        ++failures;
+    }
+}
+}
+
+int main() {
+    // x86, operands padded with spaces / x86, 공백으로 구분된 피연산자
+    expect("    1000:\te8 0b 00 00 00       \tcall   1010 <foo>", Listing::Call, "call");
+    expect("    1005:\t74 02                \tje     1009 <main+0x9>", Listing::CondJump, "je");
+    expect("    1007:\te3 02                \tjrcxz  100b <main+0xb>", Listing::CondJump, "jrcxz");
+    expect("    1009:\tc3                   \tret", Listing::Return, "ret");
+    expect("    100a:\tf3 c3                \trepz ret", Listing::Return, "ret");
+
+    // ARM32, operands after a tab / ARM32, 탭 뒤의 피연산자
+    expect("   10400:\t0a000003 \tbeq\t10414 <main+0x20>", Listing::CondJump, "beq");
+    expect("   10404:\t1a000002 \tbne\t10414 <main+0x20>", Listing::CondJump, "bne");
+    expect("   10408:\tca000001 \tbgt\t10414 <main+0x20>", Listing::CondJump, "bgt");
+    expect("   1040c:\t9a000000 \tbls\t10414 <main+0x20>", Listing::CondJump, "bls");
+    expect("   10410:\t012fff1e \tbxeq\tlr", Listing::CondJump, "bxeq");
+    expect("   10414:\t0b000010 \tbleq\t1045c <foo>", Listing::Call, "bleq");
+    expect("   10418:\teb00000f \tbl\t1045c <foo>", Listing::Call, "bl");
+    expect("   1041c:\tea000000 \tb\t10424 <main+0x30>", Listing::Jump, "b");
+    expect("   10420:\te12fff13 \tbx\tr3", Listing::Jump, "bx");
+    expect("   10424:\te12fff1e \tbx\tlr", Listing::Return, "bx");
+    expect("   10428:\te1a00000 \tmov\tr0, r0", 0, "mov");
+    expect("   1042c:\td0fe      \tbeq.n\t1042c <main+0x38>", Listing::CondJump, "beq.n");
+
+    // AArch64 / AArch64
+    expect("  400500:\t54000040 \tb.eq\t400508 <main+0x8>", Listing::CondJump, "b.eq");
+    expect("  400504:\td63f0060 \tblr\tx3", Listing::Call, "blr");
+
+    // MIPS, with the delay slot after each branch / MIPS, 분기마다 지연 슬롯
+    expect("  400100:\t03e00008 \tjr\tra", Listing::Return, "jr");
+    expect("  400104:\t00200008 \tjr\tat", Listing::Jump, "jr");
+    expect("  400108:\t0320f809 \tjalr\tt9", Listing::Call, "jalr");
+    expect("  40010c:\t0c100050 \tjal\t400140 <foo>", Listing::Call, "jal");
+    expect("  400110:\t08100044 \tj\t400110 <main+0x10>", Listing::Jump, "j");
+    expect("  400114:\t10820003 \tbeq\ta0,v0,400124 <main+0x24>", Listing::CondJump, "beq");
+    expect("  400118:\t04410002 \tbgez\tv0,400124 <main+0x24>", Listing::CondJump, "bgez");
+    expect("  40011c:\t00000000 \tnop", 0, "nop");
+
+    if (failures) return 1;
+    std::cout << "ok" << std::endl;
+    return 0;
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+# (C) Rheehose (Rhee Creative) 2008-2026
+# objdump Exit Test - A failing objdump must fail the run and leave the cache empty
+# 실패한 objdump는 실행을 실패시키고 캐시를 비워 두어야 함
+#
+# Usage: objdump_exit_test.sh <thedecoder>
+set -u
+bin=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+work=$(mktemp -d) || exit 1
+trap 'rm -rf "$work"' EXIT
+cp "$bin" "$work/victim"
+mkdir "$work/stub"
+# The head of a listing, then a non-zero exit / 목록 앞부분 출력 후 0이 아닌 상태로 종료
+cat > "$work/stub/objdump" <<'STUB'
+#!/bin/sh
+printf '\n%s:     file format elf64-x86-64\n\n\nDisassembly of section .text:\n\n' "$2"
+printf '0000000000001000 <_start>:\n    1000:\t31 ed                \txor    %%ebp,%%ebp\n'
+exit 1
+STUB
+chmod +x "$work/stub/objdump"
+
+fail() {
+    echo "FAIL: $1"
+    exit 1
+}
+
+cd "$work" || exit 1
+export HOME="$work" XDG_CACHE_HOME="$work/cache"
+PATH="$work/stub:$PATH" "$bin" victim -o stub.asm > stub.log 2>&1 && fail "exit status 1 reported as success"
+[ -s stub.asm ] || fail "the stub objdump did not run"
+PATH="$work/stub:$PATH" "$bin" victim --graph -o graph.asm > graph.log 2>&1 && fail "exit status 1 reported as success with --graph"
+mkdir batch && cp victim batch/
+PATH="$work/stub:$PATH" "$bin" --batch batch --graph -o out > batch.log 2>&1
+grep -q "	failed	" out/summary.tsv || fail "batch reported a non-zero exit as ok"
+[ -e out/victim.mermaid ] && fail "batch wrote a graph for a failed listing"
+[ -z "$(find cache -type f 2>/dev/null)" ] || fail "truncated listing was cached"
+
+# With the real objdump the listing is produced afresh / 실제 objdump로는 새로 생성
+if command -v objdump > /dev/null; then
+    "$bin" victim -o real.asm > real.log 2>&1 || fail "real objdump run failed"
+    grep -q "Served from cache" real.log && fail "real run was served from the cache"
+    [ "$(wc -l < real.asm)" -gt 8 ] || fail "real listing is truncated"
+fi
+echo "ok"